@@ -37,7 +37,7 @@ $Id: DifferentialDynamicalSystemConcept.h,v 1.1.2.2 2006/11/28 17:10:04 elferdo
 
 #include <concepts>
 #include "DynamicalSystemConcept.h"
-#include "IntegratorConcept.h"
+#include "StatefulIntegratorConcept.h"
 
 /**
  * \class DifferentialDynamicalSystemConcept
@@ -57,6 +57,6 @@ concept DifferentialDynamicalSystemConcept =
     ) {
         { system.step(h) };
     } && DynamicalSystemConcept<DynamicalSystem>
-      && IntegratorConcept<Integrator, DynamicalSystem>;
+      && AnyIntegratorConcept<Integrator, DynamicalSystem>;
 
 #endif /*DIFFERENTIALDYNAMICALSYSTEMCONCEPT_H_*/
@@ -0,0 +1,65 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef GATEDMODELCONCEPT_H_
+#define GATEDMODELCONCEPT_H_
+
+#include <concepts>
+#include "ModelConcept.h"
+
+/*
+ * \class GatedModelConcept
+ *
+ * A conductance model whose gating variables follow
+ * dx/dt = (x_inf(v) - x) / tau(v).
+ *
+ * A model of this concept must meet the requirements for ModelConcept plus:
+ *
+ * The following static method
+ * \li bool is_gate(int variable)
+ *
+ * The following method
+ * \li void gate_kinetics(precission_t * const variables, precission_t * const parameters, precission_t * const x_inf, precission_t * const tau) const
+ * This method must store x_inf and tau for every variable for which
+ * is_gate returns true. The other entries are left untouched.
+ */
+template <typename Model>
+concept GatedModelConcept = ModelConcept<Model> &&
+  requires(const Model model, int var, typename Model::precission_t* vars,
+           typename Model::precission_t* params, typename Model::precission_t* inf,
+           typename Model::precission_t* tau) {
+    { Model::is_gate(var) } -> std::convertible_to<bool>;
+    { model.gate_kinetics(vars, params, inf, tau) };
+  };
+
+#endif /*GATEDMODELCONCEPT_H_*/
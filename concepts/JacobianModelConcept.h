@@ -0,0 +1,58 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef JACOBIANMODELCONCEPT_H_
+#define JACOBIANMODELCONCEPT_H_
+
+#include <concepts>
+#include "ModelConcept.h"
+
+/*
+ * \class JacobianModelConcept
+ *
+ * A model that can compute the Jacobian of its equations analytically.
+ *
+ * A model of this concept must meet the requirements for ModelConcept plus:
+ *
+ * The following method
+ * \li void jacobian(precission_t * const variables, precission_t * const parameters, precission_t * const jac) const
+ * This method must store d incs[i] / d vars[j] in jac[i * n_variables + j].
+ */
+template <typename Model>
+concept JacobianModelConcept = ModelConcept<Model> &&
+  requires(const Model model, typename Model::precission_t* vars,
+           typename Model::precission_t* params, typename Model::precission_t* jac) {
+    { model.jacobian(vars, params, jac) };
+  };
+
+#endif /*JACOBIANMODELCONCEPT_H_*/
@@ -64,5 +64,35 @@ concept ModelConcept = requires(Model model, typename Model::precission_t* vars,
     { model.eval(vars, params, incs) };
 };
 
+/**
+ * \class ParameterHookConcept
+ *
+ * Models may also define
+ * \li void on_parameters_changed(const precission_t * const params)
+ * to keep constants derived from the parameters (reciprocals, ratios...)
+ * out of eval. SystemWrapper calls it on construction and whenever a
+ * parameter is set; code using a bare model must call it itself.
+ **/
+template <typename Model>
+concept ParameterHookConcept = requires(Model model, const typename Model::precission_t* params) {
+    { model.on_parameters_changed(params) };
+};
+
+/**
+ * \class OutputParametersConcept
+ *
+ * Models whose eval writes results (e.g. currents) into the parameters
+ * define
+ * \li static constexpr int first_output
+ * the first of those parameters, all following ones being outputs too.
+ * Outputs belong to a single system, so these models cannot share their
+ * parameters (see SharedParametersSystemWrapper, NeuronPopulation).
+ **/
+template <typename Model>
+concept OutputParametersConcept = requires {
+    { Model::first_output } -> std::convertible_to<int>;
+    requires Model::first_output < Model::n_parameters;
+};
+
 
 #endif /*MODELCONCEPT_H_*/
@@ -0,0 +1,81 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef STATEFULINTEGRATORCONCEPT_H_
+#define STATEFULINTEGRATORCONCEPT_H_
+
+#include <concepts>
+#include "IntegratorConcept.h"
+
+/*
+ * \class StatefulIntegratorConcept
+ *
+ * A stateful integrator needs a state kept from one call to the next, so
+ * it may not provide the step of IntegratorConcept, only:
+ *
+ * The following nested type
+ * \li template <typename System> state_type
+ * Holds whatever the integrator needs to carry from one call to the next
+ * (last accepted step, derivative history...). Wrappers own one instance
+ * per system.
+ *
+ * The following static method
+ * \li void step(System &s, precission_t h, precission_t * const variables, precission_t * const parameters, state_type<System> &state)
+ *
+ * And state_type must provide
+ * \li void reset()
+ * Called whenever the state of the system changes discontinuously.
+ */
+template <typename Integrator, typename System>
+concept StatefulIntegratorConcept =
+    requires(
+            System& s,
+            typename System::precission_t h,
+            typename System::precission_t* const vars,
+            typename System::precission_t* const params,
+            typename Integrator::template state_type<System>& state) {
+      Integrator::template step<System>(s, h, vars, params, state);
+      { state.reset() };
+    };
+
+/*
+ * \class AnyIntegratorConcept
+ *
+ * Integrators that wrappers can use: stateless ones, and stateful ones
+ * for which they keep the state (see IntegratorState).
+ */
+template <typename Integrator, typename System>
+concept AnyIntegratorConcept =
+    IntegratorConcept<Integrator, System> || StatefulIntegratorConcept<Integrator, System>;
+
+#endif /*STATEFULINTEGRATORCONCEPT_H_*/
@@ -0,0 +1,214 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <Checkpoint.h>
+#include <DiffusionSynapsis.h>
+#include <DifferentialNeuronWrapper.h>
+#include <ElectricalSynapsis.h>
+#include <HodgkinHuxleyModel.h>
+#include <Network.h>
+#include <NeuronPopulation.h>
+#include <SerializableWrapper.h>
+#include <SynapseKinds.h>
+#include <SystemWrapper.h>
+#include <RungeKutta4.h>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <vector>
+
+typedef RungeKutta4 Integrator;
+typedef DifferentialNeuronWrapper<SerializableWrapper<SystemWrapper<HodgkinHuxleyModel<double>>>, Integrator> HH;
+typedef DiffusionSynapsis<HH, HH, Integrator, double> Chemical;
+typedef ElectricalSynapsis<HH, HH> Electrical;
+
+typedef NeuronPopulation<HodgkinHuxleyModel<double>, Integrator> Population;
+typedef DiffusionSynapsisKind<double> Diffusion;
+typedef Network<Population, Integrator, Diffusion> Net;
+
+const double step = 0.01;
+
+/* Two neurons with a chemical and an electrical synapsis, as objects */
+struct Circuit {
+  HH h1, h2;
+  Chemical chemical;
+  Electrical electrical;
+
+  Circuit(HH::ConstructorArgs &args, Chemical::ConstructorArgs &syn_args)
+      : h1(args), h2(args), chemical(h1, HH::v, h2, HH::v, syn_args, 1),
+        electrical(h1, HH::v, h2, HH::v, 0.0001, 0.0001) {
+    h1.set(HH::v, -75);
+  }
+
+  void run(int steps, std::vector<double> &trace) {
+    for (int n = 0; n < steps; ++n) {
+      chemical.step(step);
+      electrical.step(step);
+
+      h1.add_synaptic_input(0.1);
+      h1.step(step);
+      h2.step(step);
+
+      trace.push_back(h2.get(HH::v));
+    }
+  }
+};
+
+template <typename T>
+bool identical(std::vector<T> const &a, std::vector<T> const &b) {
+  return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+}
+
+/*
+ * Runs a small circuit of objects and a network of neurons (first
+ * argument, 1000 by default) with delayed spikes for 100 ms, checkpointing
+ * them halfway. Restoring the checkpoints into freshly built copies and
+ * running the second half again must give the same values, bit for bit.
+ */
+int main(int argc, char **argv) {
+  const int neurons = argc > 1 ? std::atoi(argv[1]) : 1000;
+  const int fanin = 20;
+  const int half = 5000;
+
+  HH::ConstructorArgs args;
+
+  args.params[HH::cm] = 1 * 7.854e-3;
+  args.params[HH::vna] = 50;
+  args.params[HH::vk] = -77;
+  args.params[HH::vl] = -54.387;
+  args.params[HH::gna] = 120 * 7.854e-3;
+  args.params[HH::gk] = 36 * 7.854e-3;
+  args.params[HH::gl] = 0.3 * 7.854e-3;
+
+  Chemical::ConstructorArgs syn_args;
+  syn_args.params[Chemical::alpha] = 1.1;
+  syn_args.params[Chemical::beta] = 0.19;
+  syn_args.params[Chemical::threshold] = 0;
+  syn_args.params[Chemical::esyn] = 0;
+  syn_args.params[Chemical::gsyn] = -0.0005;
+  syn_args.params[Chemical::T] = 1;
+  syn_args.params[Chemical::max_release_time] = 1;
+
+  const std::string circuit_path = "circuit.ckpt", network_path = "network.ckpt";
+
+  std::vector<double> first, resumed, ignored;
+
+  Circuit circuit(args, syn_args);
+  circuit.run(half, ignored);
+  neun::checkpoint::save(circuit_path, circuit.h1, circuit.h2, circuit.chemical, circuit.electrical);
+  circuit.run(half, first);
+
+  Circuit restored(args, syn_args);
+  neun::checkpoint::load(circuit_path, restored.h1, restored.h2, restored.chemical, restored.electrical);
+  restored.run(half, resumed);
+
+  std::cout << "Objects resume identically: " << (identical(first, resumed) ? "yes" : "no") << std::endl;
+
+  Population::ConstructorArgs population_args;
+  std::copy(args.params, args.params + HH::n_parameters, population_args.params);
+
+  Diffusion::ConstructorArgs diffusion_args;
+  std::copy(syn_args.params, syn_args.params + Chemical::n_parameters, diffusion_args.params);
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> pick(0, neurons - 1);
+  std::uniform_int_distribution<int> delay(0, 5 / step);
+
+  std::vector<Net::group_type<Diffusion>::connection> connections;
+
+  for (int post = 0; post < neurons; ++post) {
+    for (int k = 0; k < fanin; ++k) {
+      connections.push_back({pick(rng), post, 1, delay(rng)});
+    }
+  }
+
+  auto build = [&](Net &network) {
+    network.add_population(neurons, population_args);
+    network.connect<Diffusion>(0, HH::v, 0, HH::v, connections, diffusion_args);
+
+    for (int i = 0; i < neurons; ++i) {
+      network.population(0).set(i, HH::v, -75 + 0.01 * i);
+    }
+  };
+
+  auto run = [&](Net &network, int steps) {
+    for (int n = 0; n < steps; ++n) {
+      for (int i = 0; i < neurons; ++i) {
+        network.population(0).add_synaptic_input(i, 0.08 + 1e-4 * (i % 200));
+      }
+
+      network.step(step);
+    }
+  };
+
+  auto state = [&](Net &network) {
+    std::vector<double> v;
+
+    for (int i = 0; i < neurons; ++i) {
+      for (int var = 0; var < HH::n_variables; ++var) {
+        v.push_back(network.population(0).get(i, static_cast<HH::variable>(var)));
+      }
+    }
+
+    return v;
+  };
+
+  Net network, restarted;
+  build(network);
+  build(restarted);
+
+  run(network, half);
+
+  auto start = std::chrono::steady_clock::now();
+  neun::checkpoint::save(network_path, network);
+  auto middle = std::chrono::steady_clock::now();
+  neun::checkpoint::load(network_path, restarted);
+  auto end = std::chrono::steady_clock::now();
+
+  run(network, half);
+  run(restarted, half);
+
+  std::cout << "Network resumes identically: " << (identical(state(network), state(restarted)) ? "yes" : "no")
+            << std::endl;
+  std::cout << "Network checkpoint: " << std::filesystem::file_size(network_path) << " bytes, saved in "
+            << std::chrono::duration<double, std::milli>(middle - start).count() << " ms, loaded in "
+            << std::chrono::duration<double, std::milli>(end - middle).count() << " ms" << std::endl;
+
+  std::filesystem::remove(circuit_path);
+  std::filesystem::remove(network_path);
+
+  return 0;
+}
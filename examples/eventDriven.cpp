@@ -0,0 +1,149 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <EventDrivenWrapper.h>
+#include <IntegratedSystemWrapper.h>
+#include <IzhikevichSystemWrapper.h>
+#include <RungeKutta4.h>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+typedef RungeKutta4 Integrator;
+typedef IntegratedSystemWrapper<IzhikevichSystemWrapper<double>, Integrator> Neuron;
+typedef EventDrivenWrapper<Neuron> EventNeuron;
+
+const double simulation_time = 10000;
+const double pulse_length = 1;
+
+/* Times at which each neuron starts receiving a pulse, about every 2 s */
+std::vector<std::vector<double>> pulse_times(int neurons) {
+  std::mt19937 rng(1);
+  std::exponential_distribution<double> interval(1.0 / 2000);
+  std::vector<std::vector<double>> times(neurons);
+
+  for (std::vector<double> &t : times) {
+    for (double time = interval(rng); time < simulation_time; time += pulse_length + interval(rng)) {
+      t.push_back(time);
+    }
+  }
+
+  return times;
+}
+
+template <typename N>
+void initialise(N &neuron) {
+  neuron.set(Neuron::a, 0.02);
+  neuron.set(Neuron::b, 0.2);
+  neuron.set(Neuron::c, -65);
+  neuron.set(Neuron::d, 8);
+  neuron.set(Neuron::threshold, 30);
+
+  // Resting state of these parameters
+  neuron.set(Neuron::v, -70);
+  neuron.set(Neuron::u, -14);
+}
+
+/* Steps the neurons with pulses of input, returns the elapsed seconds */
+template <typename N>
+double run(std::vector<N> &neurons, std::vector<std::vector<double>> const &times, double step) {
+  const long steps = std::lround(simulation_time / step);
+  std::vector<std::size_t> next(neurons.size(), 0);
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (long n = 0; n < steps; ++n) {
+    const double time = n * step;
+
+    for (std::size_t i = 0; i < neurons.size(); ++i) {
+      while (next[i] < times[i].size() && times[i][next[i]] + pulse_length <= time) {
+        ++next[i];
+      }
+
+      if (next[i] < times[i].size() && times[i][next[i]] <= time) {
+        neurons[i].add_synaptic_input(10);
+      }
+
+      neurons[i].step(step);
+    }
+  }
+
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*
+ * Integrates neurons (first argument, 200 by default) receiving sparse
+ * pulses of input, once stepping every neuron and once skipping the steps
+ * of resting neurons, with two step sizes. Reports the fraction of steps
+ * skipped and the largest difference in voltage at the end. The rest test
+ * is on the rate of change, so it skips about the same fraction of the
+ * time whatever the step.
+ */
+int main(int argc, char **argv) {
+  const int neurons = argc > 1 ? std::atoi(argv[1]) : 200;
+  const std::vector<std::vector<double>> times = pulse_times(neurons);
+
+  for (double step : {0.05, 0.025}) {
+    Neuron::ConstructorArgs args;
+
+    std::vector<Neuron> plain(neurons, Neuron(args));
+    std::vector<EventNeuron> event(neurons, EventNeuron(args));
+
+    for (int i = 0; i < neurons; ++i) {
+      initialise(plain[i]);
+      initialise(event[i]);
+    }
+
+    const double plain_time = run(plain, times, step);
+    const double event_time = run(event, times, step);
+
+    unsigned long skipped = 0;
+    double max_diff = 0;
+
+    for (int i = 0; i < neurons; ++i) {
+      skipped += event[i].skipped_steps();
+      max_diff = std::max(max_diff, std::abs(plain[i].get(Neuron::v) - event[i].get(Neuron::v)));
+    }
+
+    const double total = double(neurons) * std::lround(simulation_time / step);
+
+    std::cout << "Step " << step << " ms: " << 100 * skipped / total << "% of steps skipped, max voltage difference "
+              << max_diff << " mV" << std::endl;
+    std::cout << "  every step: " << plain_time << " s, event driven: " << event_time << " s" << std::endl;
+  }
+
+  return 0;
+}
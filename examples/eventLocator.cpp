@@ -0,0 +1,122 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <EventLocator.h>
+#include <IntegratedSystemWrapper.h>
+#include <IzhikevichSystemWrapper.h>
+#include <RungeKutta4.h>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+typedef IntegratedSystemWrapper<IzhikevichSystemWrapper<double>, EventLocator<RungeKutta4>> Neuron;
+
+const double simulation_time = 200;
+
+/*
+ * Times of the upward crossings of 0 mV by a tonically firing Izhikevich
+ * neuron. Sets ok to false if an event falls outside the step that
+ * reported it or before the previous one.
+ */
+std::vector<double> events(double step, bool &ok) {
+  Neuron::ConstructorArgs args;
+  Neuron neuron(args);
+
+  neuron.set(Neuron::a, 0.02);
+  neuron.set(Neuron::b, 0.2);
+  neuron.set(Neuron::c, -65);
+  neuron.set(Neuron::d, 8);
+  neuron.set(Neuron::threshold, 30);
+  neuron.set(Neuron::v, -70);
+  neuron.set(Neuron::u, -14);
+
+  neuron.integrator_state().add_crossing(Neuron::v, 0);
+
+  std::vector<double> times;
+  ok = true;
+
+  const long steps = std::lround(simulation_time / step);
+
+  for (long n = 0; n < steps; ++n) {
+    neuron.add_synaptic_input(10);
+    neuron.step(step);
+
+    for (auto const &e : neuron.integrator_state().events) {
+      ok = ok && e.time >= n * step - 1e-9 && e.time <= (n + 1) * step + 1e-9;
+      ok = ok && (times.empty() || e.time > times.back());
+      times.push_back(e.time);
+    }
+  }
+
+  return times;
+}
+
+/*
+ * Locates the spikes of an Izhikevich neuron with EventLocator at two
+ * steps. Every spike resets the neuron in post_step, which resets the
+ * state of the integrator, but event times must keep following the
+ * simulated time: each one within the step that reported it, in
+ * increasing order, and matching those of the finer step.
+ */
+int main(int argc, char **argv) {
+  bool fine_ok, coarse_ok;
+
+  const std::vector<double> fine = events(0.001, fine_ok);
+  const std::vector<double> coarse = events(0.01, coarse_ok);
+
+  std::cout << "Spikes: " << coarse.size() << " at step 0.01, " << fine.size() << " at step 0.001" << std::endl;
+
+  std::cout << "First spikes:";
+
+  for (std::size_t i = 0; i < std::min<std::size_t>(4, coarse.size()); ++i) {
+    std::cout << " " << coarse[i];
+  }
+
+  std::cout << std::endl;
+
+  std::cout << "Event times within their step and increasing: " << (fine_ok && coarse_ok ? "yes" : "no")
+            << std::endl;
+
+  if (fine.size() == coarse.size()) {
+    double difference = 0;
+
+    for (std::size_t i = 0; i < fine.size(); ++i) {
+      difference = std::max(difference, std::abs(fine[i] - coarse[i]));
+    }
+
+    std::cout << "Max difference with step 0.001: " << difference << " ms" << std::endl;
+  }
+
+  return 0;
+}
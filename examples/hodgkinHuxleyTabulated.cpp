@@ -0,0 +1,131 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DifferentialNeuronWrapper.h>
+#include <HodgkinHuxleyModel.h>
+#include <HodgkinHuxleyTabulatedModel.h>
+#include <RungeKutta4.h>
+#include <SystemWrapper.h>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+typedef RungeKutta4 Integrator;
+typedef DifferentialNeuronWrapper<SystemWrapper<HodgkinHuxleyModel<double>>, Integrator> Exact;
+typedef DifferentialNeuronWrapper<SystemWrapper<HodgkinHuxleyTabulatedModel<double>>, Integrator> Tabulated;
+
+const double step = 0.01;
+
+template <typename N>
+N build() {
+  typename N::ConstructorArgs args;
+
+  args.params[N::cm] = 1 * 7.854e-3;
+  args.params[N::vna] = 50;
+  args.params[N::vk] = -77;
+  args.params[N::vl] = -54.387;
+  args.params[N::gna] = 120 * 7.854e-3;
+  args.params[N::gk] = 36 * 7.854e-3;
+  args.params[N::gl] = 0.3 * 7.854e-3;
+
+  N n(args);
+
+  n.set(N::v, -65);
+  n.set(N::m, 0.05);
+  n.set(N::h, 0.6);
+  n.set(N::n, 0.32);
+
+  return n;
+}
+
+/* Integrates the neuron for time ms, returns the voltage trace and the elapsed seconds */
+template <typename N>
+double run(N &n, double time, std::vector<double> &trace) {
+  auto start = std::chrono::steady_clock::now();
+
+  for (long i = 0; i < std::lround(time / step); ++i) {
+    n.add_synaptic_input(0.08);
+    n.step(step);
+    trace.push_back(n.get(N::v));
+  }
+
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+double max_difference(std::vector<double> const &a, std::vector<double> const &b) {
+  double diff = 0;
+
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    diff = std::max(diff, std::abs(a[i] - b[i]));
+  }
+
+  return diff;
+}
+
+/*
+ * Integrates a tonically spiking Hodgkin-Huxley neuron with the exact rate
+ * functions and with tabulated ones, on the default grid and on a coarse
+ * one, and compares the voltage traces. A neuron copied after the grid
+ * changes keeps the table of the original.
+ */
+int main(int argc, char **argv) {
+  const double time = 1000;
+
+  Exact exact = build<Exact>();
+  Tabulated fine = build<Tabulated>();
+
+  Tabulated::set_grid(-100, 60, 1);
+
+  Tabulated coarse = build<Tabulated>();
+  Tabulated copy = fine;
+
+  std::vector<double> exact_trace, fine_trace, coarse_trace, copy_trace;
+
+  const double exact_time = run(exact, time, exact_trace);
+  const double fine_time = run(fine, time, fine_trace);
+  run(coarse, time, coarse_trace);
+  run(copy, time, copy_trace);
+
+  std::cout << "Exact rates:         " << exact_time << " s" << std::endl;
+  std::cout << "Grid of 0.05 mV:     " << fine_time << " s, max rate error " << fine.max_rate_error()
+            << " 1/ms, max voltage difference " << max_difference(exact_trace, fine_trace) << " mV" << std::endl;
+  std::cout << "Grid of 1 mV:        max rate error " << coarse.max_rate_error()
+            << " 1/ms, max voltage difference " << max_difference(exact_trace, coarse_trace) << " mV"
+            << std::endl;
+  std::cout << "Copy keeps its table: "
+            << (copy.max_rate_error() == fine.max_rate_error() && copy_trace == fine_trace ? "yes" : "no")
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,188 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DiffusionSynapsis.h>
+#include <HodgkinHuxleyModel.h>
+#include <MappedState.h>
+#include <Network.h>
+#include <NeuronPopulation.h>
+#include <SynapseKinds.h>
+#include <RungeKutta4.h>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <vector>
+
+typedef RungeKutta4 Integrator;
+typedef HodgkinHuxleyModel<double> HH;
+
+typedef NeuronPopulation<HH, Integrator> Population;
+typedef DiffusionSynapsisKind<double> Diffusion;
+typedef Network<Population, Integrator, Diffusion> Net;
+
+typedef DiffusionSynapsisModel<double> Synapsis;
+
+const double step = 0.01;
+
+/*
+ * Warms up a random network of neurons (first argument, 1000 by default)
+ * with 20 delayed diffusion synapses each for 200 ms, with its state in a
+ * memory mapped file. Then runs 20 ms of several variants of the synaptic
+ * conductance, each starting from the warm state by mapping the file copy
+ * on write. The variant with the warm-up conductance must match the warm
+ * network continuing on its own, bit for bit.
+ */
+int main(int argc, char **argv) {
+  const int neurons = argc > 1 ? std::atoi(argv[1]) : 1000;
+  const int fanin = 20;
+  const int warm_steps = 20000, variant_steps = 2000;
+
+  Population::ConstructorArgs args;
+
+  args.params[HH::cm] = 1 * 7.854e-3;
+  args.params[HH::vna] = 50;
+  args.params[HH::vk] = -77;
+  args.params[HH::vl] = -54.387;
+  args.params[HH::gna] = 120 * 7.854e-3;
+  args.params[HH::gk] = 36 * 7.854e-3;
+  args.params[HH::gl] = 0.3 * 7.854e-3;
+
+  Diffusion::ConstructorArgs syn_args;
+  syn_args.params[Synapsis::alpha] = 1.1;
+  syn_args.params[Synapsis::beta] = 0.19;
+  syn_args.params[Synapsis::threshold] = 0;
+  syn_args.params[Synapsis::esyn] = 0;
+  syn_args.params[Synapsis::gsyn] = -0.0005;
+  syn_args.params[Synapsis::T] = 1;
+  syn_args.params[Synapsis::max_release_time] = 1;
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> pick(0, neurons - 1);
+  std::uniform_int_distribution<int> delay(0, 5 / step);
+
+  std::vector<Net::group_type<Diffusion>::connection> connections;
+
+  for (int post = 0; post < neurons; ++post) {
+    for (int k = 0; k < fanin; ++k) {
+      connections.push_back({pick(rng), post, 1, delay(rng)});
+    }
+  }
+
+  auto build = [&](Net &network) {
+    network.add_population(neurons, args);
+    network.connect<Diffusion>(0, HH::v, 0, HH::v, connections, syn_args);
+
+    for (int i = 0; i < neurons; ++i) {
+      network.population(0).set(i, HH::v, -75 + 0.01 * i);
+    }
+  };
+
+  auto run = [&](Net &network, int steps) {
+    for (int n = 0; n < steps; ++n) {
+      for (int i = 0; i < neurons; ++i) {
+        network.population(0).add_synaptic_input(i, 0.08 + 1e-4 * (i % 200));
+      }
+
+      network.step(step);
+    }
+  };
+
+  auto potentials = [&](Net &network) {
+    std::vector<double> v(neurons);
+
+    for (int i = 0; i < neurons; ++i) {
+      v[i] = network.population(0).get(i, HH::v);
+    }
+
+    return v;
+  };
+
+  const std::string path = "warm.state";
+
+  Net warm;
+  build(warm);
+
+  MappedState warm_state(path, warm);
+
+  auto start = std::chrono::steady_clock::now();
+  run(warm, warm_steps);
+  warm_state.sync(warm);
+  auto end = std::chrono::steady_clock::now();
+
+  std::cout << "Warm-up and snapshot: " << std::chrono::duration<double>(end - start).count() << " s, "
+            << warm_state.size() << " bytes mapped" << std::endl;
+
+  std::vector<double> reference;
+
+  for (double gsyn : {-0.0005, -0.001, -0.002}) {
+    Net variant;
+    build(variant);
+
+    start = std::chrono::steady_clock::now();
+    MappedState state(path, variant, MappedState::copy_on_write);
+    end = std::chrono::steady_clock::now();
+
+    variant.synapses<Diffusion>(0).set(Synapsis::gsyn, gsyn);
+    run(variant, variant_steps);
+
+    std::vector<double> v = potentials(variant);
+    double mean = 0;
+
+    for (double x : v) {
+      mean += x / neurons;
+    }
+
+    std::cout << "gsyn " << gsyn << ": mapped in "
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms, mean v "
+              << mean << std::endl;
+
+    if (reference.empty()) {
+      reference = v;
+    }
+  }
+
+  run(warm, variant_steps);
+
+  std::vector<double> v = potentials(warm);
+
+  std::cout << "Variant matches the warm network: "
+            << (std::memcmp(v.data(), reference.data(), v.size() * sizeof(double)) == 0 ? "yes" : "no")
+            << std::endl;
+
+  std::filesystem::remove(path);
+
+  return 0;
+}
@@ -0,0 +1,131 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DifferentialNeuronWrapper.h>
+#include <HodgkinHuxleyModel.h>
+#include <NeunPrecision.h>
+#include <SystemWrapper.h>
+#include <RungeKutta4.h>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+typedef RungeKutta4 Integrator;
+
+template <typename Precission, typename Precision = neun::precision::native>
+using HH = DifferentialNeuronWrapper<SystemWrapper<HodgkinHuxleyModel<Precission>>, Integrator, Precision>;
+
+struct result {
+  std::vector<double> spikes;
+  double seconds;
+};
+
+// Spike times of a neuron driven by a constant input for the given steps
+template <typename Neuron>
+static result run(long steps, double step) {
+  typedef typename Neuron::precission_t precission_t;
+
+  typename Neuron::ConstructorArgs args;
+
+  args.params[Neuron::cm] = 1 * 7.854e-3;
+  args.params[Neuron::vna] = 50;
+  args.params[Neuron::vk] = -77;
+  args.params[Neuron::vl] = -54.387;
+  args.params[Neuron::gna] = 120 * 7.854e-3;
+  args.params[Neuron::gk] = 36 * 7.854e-3;
+  args.params[Neuron::gl] = 0.3 * 7.854e-3;
+
+  Neuron n(args);
+
+  n.set(Neuron::v, -65);
+  n.set(Neuron::m, 0.053);
+  n.set(Neuron::h, 0.596);
+  n.set(Neuron::n, 0.318);
+
+  result r;
+  precission_t last = n.get(Neuron::v);
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (long i = 0; i < steps; ++i) {
+    n.add_synaptic_input(precission_t(0.1));
+    n.step(precission_t(step));
+
+    const precission_t v = n.get(Neuron::v);
+
+    if (last < 0 && v >= 0) {
+      r.spikes.push_back(i * step);
+    }
+
+    last = v;
+  }
+
+  r.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  return r;
+}
+
+static void report(const char *name, result const &r, result const &reference) {
+  const size_t common = std::min(r.spikes.size(), reference.spikes.size());
+  double max_shift = 0;
+
+  for (size_t i = 0; i < common; ++i) {
+    max_shift = std::max(max_shift, std::abs(r.spikes[i] - reference.spikes[i]));
+  }
+
+  std::cout << name << ": " << r.seconds << " s, " << r.spikes.size() << " spikes, "
+            << "largest spike time shift " << max_shift << " ms" << std::endl;
+}
+
+/*
+ * Integrates a tonically firing Hodgkin-Huxley neuron for the given number
+ * of steps (first argument, 10^7 by default) in double and in float with
+ * every precision policy, and compares their spike times with the double
+ * run.
+ */
+int main(int argc, char **argv) {
+  const long steps = argc > 1 ? std::atol(argv[1]) : 10000000;
+  const double step = 0.001;
+
+  result reference = run<HH<double>>(steps, step);
+
+  report("double", reference, reference);
+  report("float", run<HH<float>>(steps, step), reference);
+  report("float, kahan", run<HH<float, neun::precision::kahan>>(steps, step), reference);
+  report("float, accumulate<double>",
+         run<HH<float, neun::precision::accumulate<double>>>(steps, step), reference);
+
+  return 0;
+}
@@ -0,0 +1,115 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DifferentialNeuronWrapper.h>
+#include <ChemicalSynapsis.h>
+#include <GradualActivationSynapsis.h>
+#include <HodgkinHuxleyModel.h>
+#include <SystemWrapper.h>
+#include <RungeKutta4.h>
+#include <cstdlib>
+#include <iostream>
+
+typedef RungeKutta4 Integrator;
+typedef DifferentialNeuronWrapper<SystemWrapper<HodgkinHuxleyModel<double>>, Integrator> HH;
+typedef ChemicalSynapsis<HH, HH, Integrator, double> Synapsis;
+typedef GradualActivationSynapsis<HH, HH, Integrator, double> Gradual;
+
+/*
+ * Neurons are integrated every step while the gating of both synapses is
+ * only integrated every slow_rate steps (first argument, 10 by default).
+ */
+int main(int argc, char **argv) {
+  const int slow_rate = argc > 1 ? std::atoi(argv[1]) : 10;
+
+  HH::ConstructorArgs args;
+
+  args.params[HH::cm] = 1 * 7.854e-3;
+  args.params[HH::vna] = 50;
+  args.params[HH::vk] = -77;
+  args.params[HH::vl] = -54.387;
+  args.params[HH::gna] = 120 * 7.854e-3;
+  args.params[HH::gk] = 36 * 7.854e-3;
+  args.params[HH::gl] = 0.3 * 7.854e-3;
+
+  Synapsis::ConstructorArgs syn_args;
+  syn_args.params[Synapsis::gfast] = 0.015;
+  syn_args.params[Synapsis::Esyn] = -75;
+  syn_args.params[Synapsis::sfast] = 0.2;
+  syn_args.params[Synapsis::Vfast] = -50;
+  syn_args.params[Synapsis::gslow] = 0.025;
+  syn_args.params[Synapsis::k1] = 1;
+  syn_args.params[Synapsis::k2] = 0.03;
+  syn_args.params[Synapsis::sslow] = 1;
+
+  Gradual::ConstructorArgs gradual_args;
+  gradual_args.params[Gradual::esyn] = -75;
+  gradual_args.params[Gradual::gsyn] = 0.02;
+  gradual_args.params[Gradual::tau_syn] = 20;
+  gradual_args.params[Gradual::v_r] = -20;
+  gradual_args.params[Gradual::dec_slope] = 2;
+
+  HH h1(args), h2(args), h3(args);
+
+  h1.set(HH::v, -75);
+
+  const double step = 0.01;
+
+  Synapsis s(h1, HH::v, h2, HH::v, syn_args, 1, slow_rate);
+  Gradual g(h1, HH::v, h3, HH::v, gradual_args, 1, slow_rate);
+
+  double simulation_time = 1000;
+  std::cout << "Time" << " " << "Vpre" << " " << "Vpost" << " " << "Vgradual"
+            << " " << "i" << " " << "igradual" << std::endl;
+
+  for (double time = 0; time < simulation_time; time += step) {
+    s.step(step, h1.get(HH::v), h2.get(HH::v));
+    g.step(step);
+
+    h1.add_synaptic_input(0.5);
+    h2.add_synaptic_input(0.5);
+    h3.add_synaptic_input(0.5);
+
+    h2.add_synaptic_input(s.get(Synapsis::i));
+
+    h1.step(step);
+    h2.step(step);
+    h3.step(step);
+
+    std::cout << time << " " << h1.get(HH::v) << " " << h2.get(HH::v) << " "
+              << h3.get(HH::v) << " " << s.get(Synapsis::i) << " "
+              << g.get(Gradual::i) << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,165 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DifferentialNeuronWrapper.h>
+#include <GradualActivationSynapsis.h>
+#include <HodgkinHuxleyModel.h>
+#include <Network.h>
+#include <NeuronPopulation.h>
+#include <SynapseKinds.h>
+#include <SystemWrapper.h>
+#include <RungeKutta4.h>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+typedef RungeKutta4 Integrator;
+typedef DifferentialNeuronWrapper<SystemWrapper<HodgkinHuxleyModel<double>>, Integrator> HH;
+typedef GradualActivationSynapsis<HH, HH, Integrator, double> Synapsis;
+
+typedef NeuronPopulation<HodgkinHuxleyModel<double>, Integrator> Population;
+typedef GradualActivationSynapsisKind<double> Gradual;
+typedef Network<Population, Integrator, Gradual> Net;
+
+/*
+ * Builds a random network of neurons (first argument, 1000 by default),
+ * each one receiving synapses from fanin others (second argument, 20 by
+ * default), as wrappers and synapsis objects stepped by hand and as a
+ * Network, and reports the time taken and the largest difference in v.
+ */
+int main(int argc, char **argv) {
+  const int neurons = argc > 1 ? std::atoi(argv[1]) : 1000;
+  const int fanin = argc > 2 ? std::atoi(argv[2]) : 20;
+
+  HH::ConstructorArgs args;
+
+  args.params[HH::cm] = 1 * 7.854e-3;
+  args.params[HH::vna] = 50;
+  args.params[HH::vk] = -77;
+  args.params[HH::vl] = -54.387;
+  args.params[HH::gna] = 120 * 7.854e-3;
+  args.params[HH::gk] = 36 * 7.854e-3;
+  args.params[HH::gl] = 0.3 * 7.854e-3;
+
+  Synapsis::ConstructorArgs syn_args;
+  syn_args.params[Synapsis::esyn] = -75;
+  syn_args.params[Synapsis::gsyn] = 0.002;
+  syn_args.params[Synapsis::tau_syn] = 20;
+  syn_args.params[Synapsis::v_r] = -20;
+  syn_args.params[Synapsis::dec_slope] = 2;
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> pick(0, neurons - 1);
+  std::uniform_real_distribution<double> weight(0.5, 1.5);
+
+  std::vector<Net::group_type<Gradual>::connection> connections;
+
+  for (int post = 0; post < neurons; ++post) {
+    for (int k = 0; k < fanin; ++k) {
+      connections.push_back({pick(rng), post, weight(rng)});
+    }
+  }
+
+  // Objects are created in presynaptic order, so currents are summed as in the network
+  std::stable_sort(connections.begin(), connections.end(),
+                   [](auto const &a, auto const &b) { return a.pre < b.pre; });
+
+  std::vector<HH> wrappers(neurons, HH(args));
+  std::vector<Synapsis> synapses;
+  synapses.reserve(connections.size());
+
+  for (auto const &c : connections) {
+    Synapsis::ConstructorArgs weighted = syn_args;
+    weighted.params[Synapsis::gsyn] = c.weight * syn_args.params[Synapsis::gsyn];
+
+    synapses.emplace_back(wrappers[c.pre], HH::v, wrappers[c.post], HH::v, weighted, 1);
+  }
+
+  Population::ConstructorArgs population_args;
+  std::copy(args.params, args.params + HH::n_parameters, population_args.params);
+
+  Gradual::ConstructorArgs gradual_args;
+  std::copy(syn_args.params, syn_args.params + Gradual::n_parameters, gradual_args.params);
+
+  Net network;
+  const int all = network.add_population(neurons, population_args);
+  network.connect<Gradual>(all, HH::v, all, HH::v, connections, gradual_args);
+
+  for (int i = 0; i < neurons; ++i) {
+    wrappers[i].set(HH::v, -75 + 0.01 * i);
+    network.population(all).set(i, HH::v, -75 + 0.01 * i);
+  }
+
+  const double step = 0.01;
+  const double simulation_time = 100;
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (double time = 0; time < simulation_time; time += step) {
+    for (Synapsis &s : synapses) {
+      s.step(step);
+    }
+
+    for (int i = 0; i < neurons; ++i) {
+      wrappers[i].add_synaptic_input(0.08 + 1e-4 * i);
+      wrappers[i].step(step);
+    }
+  }
+
+  auto middle = std::chrono::steady_clock::now();
+
+  for (double time = 0; time < simulation_time; time += step) {
+    for (int i = 0; i < neurons; ++i) {
+      network.population(all).add_synaptic_input(i, 0.08 + 1e-4 * i);
+    }
+
+    network.step(step);
+  }
+
+  auto end = std::chrono::steady_clock::now();
+
+  double max_diff = 0;
+
+  for (int i = 0; i < neurons; ++i) {
+    max_diff = std::max(max_diff, std::abs(wrappers[i].get(HH::v) - network.population(all).get(i, HH::v)));
+  }
+
+  std::cout << "Objects: " << std::chrono::duration<double>(middle - start).count() << " s" << std::endl;
+  std::cout << "Network: " << std::chrono::duration<double>(end - middle).count() << " s" << std::endl;
+  std::cout << "Max difference in v: " << max_diff << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,202 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DifferentialNeuronWrapper.h>
+#include <HodgkinHuxleyModel.h>
+#include <NeunMath.h>
+#include <RungeKutta4.h>
+#include <SystemWrapper.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace neun::math;
+
+/* Evenly spaced arguments in [from, to] */
+template <typename T>
+std::vector<T> arguments(double from, double to, int count = 1000000) {
+  std::vector<T> x(count);
+
+  for (int i = 0; i < count; ++i) {
+    x[i] = T(from + (to - from) * i / (count - 1));
+  }
+
+  return x;
+}
+
+/* Maximum error of f against the exact policy, relative unless absolute is set */
+template <typename Math, typename T, typename F, typename Exact>
+double error(std::vector<T> const &x, F f, Exact exact, bool absolute = false) {
+  double e = 0;
+
+  for (T a : x) {
+    const double reference = exact(a);
+    const double d = std::abs(double(f(a)) - reference);
+
+    e = std::max(e, absolute ? d : d / std::abs(reference));
+  }
+
+  return e;
+}
+
+/* Seconds taken by exp over every element of x, the loop the policies are made to vectorise */
+template <typename Math, typename T>
+double exp_time(std::vector<T> const &x, std::vector<T> &y) {
+  auto start = std::chrono::steady_clock::now();
+
+  for (int r = 0; r < 20; ++r) {
+    for (std::size_t i = 0; i < x.size(); ++i) {
+      y[i] = Math::exp(x[i]);
+    }
+  }
+
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename Math, typename T>
+void accuracy(std::string const &name, double exact_seconds) {
+  const std::vector<T> exp_x = arguments<T>(-80, 80);
+  const std::vector<T> log_near = arguments<T>(1 / std::exp(1.0), std::exp(1.0));
+  const std::vector<T> log_far = arguments<T>(std::exp(1.0), 1e6);
+  const std::vector<T> tanh_x = arguments<T>(-10, 10);
+
+  std::vector<T> y(exp_x.size());
+
+  std::cout << "  " << name << ": exp " << error<Math>(exp_x, Math::template exp<T>, exact::exp<T>)
+            << ", log " << std::max(error<Math>(log_near, Math::template log<T>, exact::log<T>, true),
+                                    error<Math>(log_far, Math::template log<T>, exact::log<T>))
+            << ", tanh " << error<Math>(tanh_x, Math::template tanh<T>, exact::tanh<T>) << ", exp throughput "
+            << exact_seconds / exp_time<Math>(exp_x, y) << "x libm" << std::endl;
+}
+
+template <typename T>
+void accuracy(std::string const &type) {
+  const std::vector<T> x = arguments<T>(-80, 80);
+  std::vector<T> y(x.size());
+  const double exact_seconds = exp_time<exact>(x, y);
+
+  std::cout << "Maximum errors against libm, " << type << ":" << std::endl;
+  accuracy<fast, T>("fast", exact_seconds);
+  accuracy<table, T>("table", exact_seconds);
+}
+
+/* Spike times (upward crossings of 0 mV) of a tonically firing neuron */
+template <typename Math>
+std::vector<double> spikes(double &seconds) {
+  typedef DifferentialNeuronWrapper<SystemWrapper<HodgkinHuxleyModel<double, Math>>, RungeKutta4> Neuron;
+
+  typename Neuron::ConstructorArgs args;
+
+  args.params[Neuron::cm] = 1 * 7.854e-3;
+  args.params[Neuron::vna] = 50;
+  args.params[Neuron::vk] = -77;
+  args.params[Neuron::vl] = -54.387;
+  args.params[Neuron::gna] = 120 * 7.854e-3;
+  args.params[Neuron::gk] = 36 * 7.854e-3;
+  args.params[Neuron::gl] = 0.3 * 7.854e-3;
+
+  Neuron n(args);
+
+  n.set(Neuron::v, -65);
+  n.set(Neuron::m, 0.05);
+  n.set(Neuron::h, 0.6);
+  n.set(Neuron::n, 0.32);
+
+  const double step = 0.001;
+  std::vector<double> times;
+  double last = n.get(Neuron::v);
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (long i = 1; i <= 1000000; ++i) {
+    n.add_synaptic_input(0.08);
+    n.step(step);
+
+    const double v = n.get(Neuron::v);
+
+    if (last < 0 && v >= 0) {
+      times.push_back((i - 1 + last / (last - v)) * step);
+    }
+
+    last = v;
+  }
+
+  seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  return times;
+}
+
+template <typename Math>
+void neuron(std::string const &name, std::vector<double> const &reference, double exact_seconds) {
+  double seconds;
+  const std::vector<double> times = spikes<Math>(seconds);
+
+  std::cout << "  " << name << ": " << times.size() << " spikes";
+
+  if (times.size() == reference.size()) {
+    double error = 0;
+
+    for (std::size_t i = 0; i < times.size(); ++i) {
+      error = std::max(error, std::abs(times[i] - reference[i]));
+    }
+
+    std::cout << ", max spike time difference " << error << " ms";
+  }
+
+  std::cout << ", " << exact_seconds / seconds << "x as fast" << std::endl;
+}
+
+/*
+ * Measures the errors of the fast and table policies of NeunMath.h against
+ * libm (the exact policy) and the throughput of their exp over an array.
+ * Then runs 1 s of a Hodgkin-Huxley neuron with each policy and compares
+ * its spike times with those of the exact one. This example is built with
+ * -fno-trapping-math so that the array loops vectorise; a single neuron
+ * calls exp one value at a time, so it gains little.
+ */
+int main(int argc, char **argv) {
+  accuracy<double>("double");
+  accuracy<float>("float");
+
+  double exact_seconds;
+  const std::vector<double> reference = spikes<exact>(exact_seconds);
+
+  std::cout << "Hodgkin-Huxley neuron, against exact (" << reference.size() << " spikes):" << std::endl;
+  neuron<fast>("fast", reference, exact_seconds);
+  neuron<table>("table", reference, exact_seconds);
+
+  return 0;
+}
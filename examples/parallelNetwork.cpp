@@ -0,0 +1,176 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <HodgkinHuxleyModel.h>
+#include <Network.h>
+#include <NeuronPopulation.h>
+#include <SynapseKinds.h>
+#include <RungeKutta4.h>
+#include <ThreadPool.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+typedef RungeKutta4 Integrator;
+typedef HodgkinHuxleyModel<double> Model;
+typedef NeuronPopulation<Model, Integrator> Population;
+typedef GradualActivationSynapsisKind<double> Gradual;
+typedef ElectricalSynapsisKind<double> Electrical;
+typedef Network<Population, Integrator, Gradual, Electrical> Net;
+
+// Two populations with random chemical synapses within and gap junctions between them
+static void build(Net &network, int neurons, int fanin) {
+  Population::ConstructorArgs args;
+
+  args.params[Model::cm] = 1 * 7.854e-3;
+  args.params[Model::vna] = 50;
+  args.params[Model::vk] = -77;
+  args.params[Model::vl] = -54.387;
+  args.params[Model::gna] = 120 * 7.854e-3;
+  args.params[Model::gk] = 36 * 7.854e-3;
+  args.params[Model::gl] = 0.3 * 7.854e-3;
+
+  Gradual::ConstructorArgs gradual_args;
+  gradual_args.params[GradualActivationSynapsisModel<double>::esyn] = -75;
+  gradual_args.params[GradualActivationSynapsisModel<double>::gsyn] = 0.002;
+  gradual_args.params[GradualActivationSynapsisModel<double>::tau_syn] = 20;
+  gradual_args.params[GradualActivationSynapsisModel<double>::v_r] = -20;
+  gradual_args.params[GradualActivationSynapsisModel<double>::dec_slope] = 2;
+
+  Electrical::ConstructorArgs electrical_args;
+  electrical_args.params[Electrical::g] = 0.001;
+
+  const int a = network.add_population(neurons / 2, args);
+  const int b = network.add_population(neurons - neurons / 2, args);
+
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<double> weight(0.5, 1.5);
+
+  for (int pre : {a, b}) {
+    for (int post : {a, b}) {
+      std::uniform_int_distribution<int> pick(0, network.population(pre).size() - 1);
+      std::vector<Net::group_type<Gradual>::connection> connections;
+
+      for (int j = 0; j < network.population(post).size(); ++j) {
+        for (int k = 0; k < fanin / 2; ++k) {
+          connections.push_back({pick(rng), j, weight(rng)});
+        }
+      }
+
+      network.connect<Gradual>(pre, Model::v, post, Model::v, connections, gradual_args);
+    }
+  }
+
+  std::vector<Net::group_type<Electrical>::connection> ab, ba;
+
+  for (int i = 0; i < network.population(a).size(); i += 4) {
+    ab.push_back({i, i, 1});
+    ba.push_back({i, i, 1});
+  }
+
+  network.connect<Electrical>(a, Model::v, b, Model::v, ab, electrical_args);
+  network.connect<Electrical>(b, Model::v, a, Model::v, ba, electrical_args);
+
+  for (int p : {a, b}) {
+    for (int i = 0; i < network.population(p).size(); ++i) {
+      network.population(p).set(i, Model::v, -75 + 20.0 * i / network.population(p).size());
+    }
+  }
+}
+
+static void input(Net &network) {
+  for (int p = 0; p < network.populations(); ++p) {
+    for (int i = 0; i < network.population(p).size(); ++i) {
+      network.population(p).add_synaptic_input(i, 0.08 + 0.02 * (i % 7));
+    }
+  }
+}
+
+/*
+ * Steps the same network (first argument neurons, 100000 by default, with
+ * 20 synapses each) serially and with 1, 2, 4 ... threads up to the
+ * hardware threads (or the second argument), reporting the time taken
+ * and whether every voltage is identical to the serial run.
+ */
+int main(int argc, char **argv) {
+  const int neurons = argc > 1 ? std::atoi(argv[1]) : 100000;
+  const int max_threads = argc > 2 ? std::atoi(argv[2]) : std::thread::hardware_concurrency();
+
+  const double step = 0.01;
+  const int steps = 100;
+
+  Net serial;
+  build(serial, neurons, 20);
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < steps; ++i) {
+    input(serial);
+    serial.step(step);
+  }
+
+  const double serial_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << "Serial: " << serial_time << " s" << std::endl;
+
+  for (int threads = 1; threads <= max_threads; threads *= 2) {
+    ThreadPool pool(threads);
+    Net parallel;
+    build(parallel, neurons, 20);
+
+    start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < steps; ++i) {
+      input(parallel);
+      parallel.step(step, pool);
+    }
+
+    const double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    bool identical = true;
+
+    for (int p = 0; p < serial.populations(); ++p) {
+      for (int i = 0; i < serial.population(p).size(); ++i) {
+        identical = identical && serial.population(p).get(i, Model::v) == parallel.population(p).get(i, Model::v);
+      }
+    }
+
+    std::cout << threads << " threads: " << time << " s, speedup " << serial_time / time
+              << (identical ? ", identical" : ", DIFFERENT") << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,173 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DifferentialNeuronWrapper.h>
+#include <MatsuokaModel.h>
+#include <RowatSelverstonModel.h>
+#include <RungeKutta4.h>
+#include <SystemWrapper.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/* The models as they were before the hook, dividing by their parameters in eval */
+template <typename Precission>
+class DividingMatsuokaModel : public MatsuokaModel<Precission> {
+  typedef MatsuokaModel<Precission> Base;
+
+ public:
+  void eval(const Precission *const vars, Precission *const params, Precission *const incs) const {
+    incs[Base::x] = (-vars[Base::x] - params[Base::beta] * vars[Base::v] + SYNAPTIC_INPUT + params[Base::c]) /
+                    params[Base::t1];
+    incs[Base::v] = (-vars[Base::v] + std::max(vars[Base::x], Precission(0))) / params[Base::t2];
+  }
+};
+
+template <typename Precission>
+class DividingRowatSelverstonModel : public RowatSelverstonModel<Precission> {
+  typedef RowatSelverstonModel<Precission> Base;
+
+ public:
+  void eval(const Precission *const vars, Precission *const params, Precission *const incs) const {
+    incs[Base::v] = -(vars[Base::v] - params[Base::af] * std::tanh(params[Base::sf] / params[Base::af] * vars[Base::v]) +
+                      vars[Base::q] - SYNAPTIC_INPUT) /
+                    params[Base::tm];
+    incs[Base::q] = (-vars[Base::q] + params[Base::ss] * (vars[Base::v] - params[Base::es])) / params[Base::ts];
+  }
+};
+
+const double step = 0.001;
+const int steps = 20000;
+
+/* Trace of every variable of neuron, driven by input */
+template <typename Neuron>
+std::vector<double> trace(Neuron &neuron, double input) {
+  std::vector<double> values;
+
+  for (int i = 0; i < steps; ++i) {
+    neuron.add_synaptic_input(input);
+    neuron.step(step);
+
+    for (int j = 0; j < Neuron::n_variables; ++j) {
+      values.push_back(neuron.get(static_cast<typename Neuron::variable>(j)));
+    }
+  }
+
+  return values;
+}
+
+bool same(std::vector<double> const &a, std::vector<double> const &b) {
+  return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0;
+}
+
+double difference(std::vector<double> const &a, std::vector<double> const &b) {
+  double d = 0;
+
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    d = std::max(d, std::abs(a[i] - b[i]));
+  }
+
+  return d;
+}
+
+/*
+ * Runs a neuron built with the changed parameters, one built with the
+ * initial ones and changed with set(parameter), a copy of the latter and
+ * one with a model that divides by its parameters in eval. The first three
+ * must give the same trace, bit for bit, and the last must match it up to
+ * rounding.
+ */
+template <typename Model, typename Dividing>
+void check(std::string const &name, typename Model::precission_t const (&params)[Model::n_parameters],
+           std::vector<std::pair<typename Model::parameter, double>> const &changes, double input) {
+  typedef DifferentialNeuronWrapper<SystemWrapper<Model>, RungeKutta4> Neuron;
+  typedef DifferentialNeuronWrapper<SystemWrapper<Dividing>, RungeKutta4> DividingNeuron;
+
+  typename Neuron::ConstructorArgs args, changed_args;
+  typename DividingNeuron::ConstructorArgs dividing_args;
+
+  std::copy(params, params + Model::n_parameters, args.params);
+  std::copy(params, params + Model::n_parameters, changed_args.params);
+
+  for (auto const &[param, value] : changes) {
+    changed_args.params[param] = value;
+  }
+
+  std::copy(changed_args.params, changed_args.params + Model::n_parameters, dividing_args.params);
+
+  Neuron built(changed_args), set(args);
+  DividingNeuron dividing(dividing_args);
+
+  for (auto const &[param, value] : changes) {
+    set.set(param, value);
+  }
+
+  Neuron copy(set);
+
+  for (int j = 0; j < Model::n_variables; ++j) {
+    const auto var = static_cast<typename Model::variable>(j);
+
+    built.set(var, 0.1);
+    set.set(var, 0.1);
+    copy.set(var, 0.1);
+    dividing.set(static_cast<typename Dividing::variable>(j), 0.1);
+  }
+
+  const std::vector<double> reference = trace(built, input);
+
+  std::cout << name << std::endl;
+  std::cout << "  Set parameters match built ones: " << (same(trace(set, input), reference) ? "yes" : "no")
+            << std::endl;
+  std::cout << "  Copy matches: " << (same(trace(copy, input), reference) ? "yes" : "no") << std::endl;
+  std::cout << "  Max difference with dividing eval: " << difference(trace(dividing, input), reference)
+            << std::endl;
+}
+
+int main(int argc, char **argv) {
+  typedef MatsuokaModel<double> Matsuoka;
+  typedef RowatSelverstonModel<double> RowatSelverston;
+
+  const double matsuoka[Matsuoka::n_parameters] = {1, 1, 1, 1};
+  const double rowat_selverston[RowatSelverston::n_parameters] = {1, 2, 2, 1, 1, 1};
+
+  check<Matsuoka, DividingMatsuokaModel<double>>("Matsuoka", matsuoka, {{Matsuoka::t1, 0.5}, {Matsuoka::t2, 3}},
+                                                 0.2);
+  check<RowatSelverston, DividingRowatSelverstonModel<double>>(
+      "RowatSelverston", rowat_selverston,
+      {{RowatSelverston::tm, 0.5}, {RowatSelverston::ts, 3}, {RowatSelverston::sf, 3}}, 0.5);
+
+  return 0;
+}
@@ -0,0 +1,151 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DifferentialNeuronWrapper.h>
+#include <HodgkinHuxleyModel.h>
+#include <ParameterSweep.h>
+#include <SpikeStatistics.h>
+#include <SystemWrapper.h>
+#include <RungeKutta4.h>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+typedef RungeKutta4 Integrator;
+typedef HodgkinHuxleyModel<double> Model;
+typedef DifferentialNeuronWrapper<SystemWrapper<Model>, Integrator> HH;
+typedef ParameterSweep<Model, Integrator> Sweep;
+
+/*
+ * Sweeps gna and gk of a Hodgkin-Huxley neuron over a grid (first
+ * argument, 16 by default, values per axis) and prints the spike
+ * statistics of each run. The same runs are then made one after another
+ * with neuron objects, as a loop over separate simulations would, and
+ * must give the same statistics.
+ */
+int main(int argc, char **argv) {
+  const int points = argc > 1 ? std::atoi(argv[1]) : 16;
+
+  Sweep::ConstructorArgs args;
+
+  args.params[HH::cm] = 1 * 7.854e-3;
+  args.params[HH::vna] = 50;
+  args.params[HH::vk] = -77;
+  args.params[HH::vl] = -54.387;
+  args.params[HH::gna] = 120 * 7.854e-3;
+  args.params[HH::gk] = 36 * 7.854e-3;
+  args.params[HH::gl] = 0.3 * 7.854e-3;
+
+  std::vector<double> gna, gk;
+
+  for (int i = 0; i < points; ++i) {
+    gna.push_back(args.params[HH::gna] * (0.6 + 0.8 * i / points));
+    gk.push_back(args.params[HH::gk] * (0.6 + 0.8 * i / points));
+  }
+
+  Sweep sweep(args);
+  sweep.vary(HH::gna, gna);
+  sweep.vary(HH::gk, gk);
+  sweep.set(HH::v, -65);
+
+  Sweep::settings settings;
+  settings.h = 0.01;
+  settings.duration = 500;
+  settings.transient = 100;
+  settings.measured = HH::v;
+  settings.threshold = 0;
+  settings.burst_gap = 50;
+  settings.input = 0.1;
+
+  ThreadPool pool;
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<Sweep::summary> summaries = sweep.run(settings, pool);
+  auto middle = std::chrono::steady_clock::now();
+
+  std::vector<Sweep::summary> objects;
+
+  for (int r = 0; r < sweep.size(); ++r) {
+    HH::ConstructorArgs run_args;
+    std::copy(sweep.run(r).params, sweep.run(r).params + HH::n_parameters, run_args.params);
+
+    HH neuron(run_args);
+
+    for (int i = 0; i < HH::n_variables; ++i) {
+      neuron.set(static_cast<HH::variable>(i), i == HH::v ? -65 : 0);
+    }
+
+    SpikeStatistics<double> statistics(settings.threshold, settings.burst_gap);
+
+    const long steps = settings.duration / settings.h;
+    const long transient = settings.transient / settings.h;
+
+    for (long n = 0; n < steps; ++n) {
+      neuron.add_synaptic_input(settings.input);
+      neuron.step(settings.h);
+
+      if (n + 1 >= transient) {
+        statistics.sample((n + 1) * settings.h, neuron.get(HH::v));
+      }
+    }
+
+    objects.push_back(statistics.get());
+  }
+
+  auto end = std::chrono::steady_clock::now();
+
+  std::cout << "gna\tgk\tspikes\tperiod\tperiod_sd\tbursts" << std::endl;
+
+  for (int r = 0; r < sweep.size(); ++r) {
+    Sweep::summary const &s = summaries[r];
+
+    std::cout << sweep.run(r).params[HH::gna] << "\t" << sweep.run(r).params[HH::gk] << "\t" << s.spikes
+              << "\t" << s.period << "\t" << s.period_sd << "\t" << s.bursts << std::endl;
+  }
+
+  bool identical = true;
+
+  for (int r = 0; r < sweep.size(); ++r) {
+    identical = identical && summaries[r].spikes == objects[r].spikes && summaries[r].bursts == objects[r].bursts &&
+                std::memcmp(&summaries[r].period, &objects[r].period, sizeof(double)) == 0;
+  }
+
+  std::cerr << sweep.size() << " runs" << std::endl;
+  std::cerr << "Sweep:   " << std::chrono::duration<double>(middle - start).count() << " s" << std::endl;
+  std::cerr << "Objects: " << std::chrono::duration<double>(end - middle).count() << " s" << std::endl;
+  std::cerr << "Same statistics: " << (identical ? "yes" : "no") << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,117 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DifferentialNeuronWrapper.h>
+#include <HodgkinHuxleyModel.h>
+#include <NeuronPopulation.h>
+#include <SystemWrapper.h>
+#include <RungeKutta4.h>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+typedef RungeKutta4 Integrator;
+typedef DifferentialNeuronWrapper<SystemWrapper<HodgkinHuxleyModel<double>>, Integrator> HH;
+typedef NeuronPopulation<HodgkinHuxleyModel<double>, Integrator> Population;
+
+/*
+ * Integrates the same neurons (first argument, 1000 by default), each one
+ * with a different input, as a vector of wrappers and as a population, and
+ * reports the time taken and the largest difference in v.
+ */
+int main(int argc, char **argv) {
+  const int neurons = argc > 1 ? std::atoi(argv[1]) : 1000;
+
+  HH::ConstructorArgs args;
+
+  args.params[HH::cm] = 1 * 7.854e-3;
+  args.params[HH::vna] = 50;
+  args.params[HH::vk] = -77;
+  args.params[HH::vl] = -54.387;
+  args.params[HH::gna] = 120 * 7.854e-3;
+  args.params[HH::gk] = 36 * 7.854e-3;
+  args.params[HH::gl] = 0.3 * 7.854e-3;
+
+  Population::ConstructorArgs population_args;
+  std::copy(args.params, args.params + HH::n_parameters, population_args.params);
+
+  std::vector<HH> wrappers(neurons, HH(args));
+  Population population(neurons, population_args);
+
+  for (int i = 0; i < neurons; ++i) {
+    wrappers[i].set(HH::v, -75 + 0.01 * i);
+    population.set(i, HH::v, -75 + 0.01 * i);
+  }
+
+  const double step = 0.01;
+  const double simulation_time = 100;
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (double time = 0; time < simulation_time; time += step) {
+    for (int i = 0; i < neurons; ++i) {
+      wrappers[i].add_synaptic_input(0.05 + 1e-4 * i);
+      wrappers[i].step(step);
+    }
+  }
+
+  auto middle = std::chrono::steady_clock::now();
+
+  for (double time = 0; time < simulation_time; time += step) {
+    for (int i = 0; i < neurons; ++i) {
+      population.add_synaptic_input(i, 0.05 + 1e-4 * i);
+    }
+
+    population.step(step);
+  }
+
+  auto end = std::chrono::steady_clock::now();
+
+  double max_diff = 0;
+
+  for (int i = 0; i < neurons; ++i) {
+    max_diff = std::max(max_diff, std::abs(wrappers[i].get(HH::v) - population.get(i, HH::v)));
+  }
+
+  std::cout << "Wrappers:   " << std::chrono::duration<double>(middle - start).count() << " s, "
+            << sizeof(HH) << " bytes per neuron" << std::endl;
+  std::cout << "Population: " << std::chrono::duration<double>(end - middle).count() << " s, "
+            << sizeof(Population) << " bytes + "
+            << (sizeof(HodgkinHuxleyModel<double>) + HH::n_variables * sizeof(double))
+            << " bytes per neuron" << std::endl;
+  std::cout << "Max difference in v: " << max_diff << std::endl;
+
+  return 0;
+}
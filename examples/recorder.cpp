@@ -0,0 +1,123 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DifferentialNeuronWrapper.h>
+#include <HodgkinHuxleyModel.h>
+#include <Recorder.h>
+#include <RungeKutta4.h>
+#include <SystemWrapper.h>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+typedef RungeKutta4 Integrator;
+typedef DifferentialNeuronWrapper<SystemWrapper<HodgkinHuxleyModel<double>>, Integrator>
+    Neuron;
+
+static Neuron make_neuron() {
+  Neuron::ConstructorArgs args;
+
+  args.params[Neuron::cm] = 1 * 7.854e-3;
+  args.params[Neuron::vna] = 50;
+  args.params[Neuron::vk] = -77;
+  args.params[Neuron::vl] = -54.387;
+  args.params[Neuron::gna] = 120 * 7.854e-3;
+  args.params[Neuron::gk] = 36 * 7.854e-3;
+  args.params[Neuron::gl] = 0.3 * 7.854e-3;
+
+  Neuron n(args);
+
+  n.set(Neuron::v, -80);
+  n.set(Neuron::m, 0.1);
+  n.set(Neuron::n, 0.7);
+  n.set(Neuron::h, 0.01);
+
+  return n;
+}
+
+/*
+ * Runs the simulation of basic.cpp twice: writing time and v as text
+ * (to basic.txt) and recording v, m, h and n with a Recorder (to the
+ * file given as first argument, trace.bin by default). Then reads the
+ * trace back, checks it against the text output and reports the time
+ * taken by each run.
+ */
+int main(int argc, char **argv) {
+  const char *path = argc > 1 ? argv[1] : "trace.bin";
+
+  const double step = 0.001;
+  const double simulation_time = 100;
+
+  std::vector<double> text_v;
+
+  auto start = std::chrono::steady_clock::now();
+  {
+    Neuron n = make_neuron();
+    std::ofstream text("basic.txt");
+
+    for (double time = 0; time < simulation_time; time += step) {
+      n.step(step);
+
+      text << time << " " << n.get(Neuron::v) << std::endl;
+      text_v.push_back(n.get(Neuron::v));
+    }
+  }
+  auto middle = std::chrono::steady_clock::now();
+  {
+    Neuron n = make_neuron();
+    Recorder<double> recorder(path, step);
+
+    recorder.add(n, Neuron::v, "v");
+    recorder.add(n, Neuron::m, "m");
+    recorder.add(n, Neuron::h, "h");
+    recorder.add(n, Neuron::n, "n");
+
+    for (double time = 0; time < simulation_time; time += step) {
+      n.step(step);
+      recorder.sample();
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  Recorder<double>::trace trace = Recorder<double>::read(path);
+
+  bool identical = trace.columns[0] == text_v;
+
+  std::cout << "Text:     " << std::chrono::duration<double>(middle - start).count() << " s" << std::endl;
+  std::cout << "Recorder: " << std::chrono::duration<double>(end - middle).count() << " s, "
+            << trace.columns.size() << " columns of " << trace.columns[0].size() << " rows"
+            << (identical ? ", v identical" : ", v DIFFERENT") << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DifferentialNeuronWrapper.h>
+#include <HodgkinHuxleyModel.h>
+#include <Recorder.h>
+#include <RungeKutta4.h>
+#include <SystemWrapper.h>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <string>
+
+typedef RungeKutta4 Integrator;
+typedef DifferentialNeuronWrapper<SystemWrapper<HodgkinHuxleyModel<double>>, Integrator>
+    Neuron;
+
+const double step = 0.005;
+const double simulation_time = 10000;
+
+// Simulates a tonically firing neuron, recording it as set up by configure
+static void run(std::string const &path, int decimation,
+                std::function<void(Recorder<double> &, Neuron const &)> configure) {
+  Neuron::ConstructorArgs args;
+
+  args.params[Neuron::cm] = 1 * 7.854e-3;
+  args.params[Neuron::vna] = 50;
+  args.params[Neuron::vk] = -77;
+  args.params[Neuron::vl] = -54.387;
+  args.params[Neuron::gna] = 120 * 7.854e-3;
+  args.params[Neuron::gk] = 36 * 7.854e-3;
+  args.params[Neuron::gl] = 0.3 * 7.854e-3;
+
+  Neuron n(args);
+  n.set(Neuron::v, -65);
+
+  {
+    Recorder<double> recorder(path, step, decimation);
+    configure(recorder, n);
+
+    for (double time = 0; time < simulation_time; time += step) {
+      n.add_synaptic_input(0.1);
+      n.step(step);
+      recorder.sample();
+    }
+  }
+
+  Recorder<double>::trace trace = Recorder<double>::read(path);
+
+  std::cout << path << ": " << std::filesystem::file_size(path) << " bytes";
+
+  for (size_t c = 0; c < trace.names.size(); ++c) {
+    std::cout << ", " << trace.names[c] << " " << trace.columns[c].size() << " rows";
+  }
+
+  std::cout << std::endl;
+}
+
+/*
+ * Records 10 s of a tonically firing neuron at step 0.005 ms (2 million
+ * steps) in full and reduced at the source in several ways, reporting
+ * the size of each file.
+ */
+int main(int argc, char **argv) {
+  run("full.bin", 1, [](Recorder<double> &r, Neuron const &n) {
+    r.add(n, Neuron::v, "v");
+    r.add(n, Neuron::m, "m");
+    r.add(n, Neuron::h, "h");
+    r.add(n, Neuron::n, "n");
+  });
+
+  // v every 0.1 ms, gates every 1 ms
+  run("decimated.bin", 20, [](Recorder<double> &r, Neuron const &n) {
+    r.add(n, Neuron::v, "v");
+    r.add(n, Neuron::m, "m", 200);
+    r.add(n, Neuron::h, "h", 200);
+    r.add(n, Neuron::n, "n", 200);
+  });
+
+  // Minimum and maximum of v every 1 ms, enough to plot the whole run
+  run("envelope.bin", 1, [](Recorder<double> &r, Neuron const &n) {
+    r.add_envelope(n, Neuron::v, "v", 200);
+  });
+
+  // Full resolution from 2 ms before to 5 ms after every spike of the last second
+  run("spikes.bin", 1, [](Recorder<double> &r, Neuron const &n) {
+    r.add(n, Neuron::v, "v");
+    r.add(n, Neuron::n, "n");
+    r.trigger(n, Neuron::v, 0, 2, 5);
+    r.record_between(9000, 10000);
+  });
+
+  return 0;
+}
@@ -0,0 +1,137 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <ChemicalSynapsisModel.h>
+#include <DifferentialDynamicalSystemWrapper.h>
+#include <DifferentialNeuronWrapper.h>
+#include <Euler.h>
+#include <HodgkinHuxleyModel.h>
+#include <Rosenbrock2.h>
+#include <RungeKutta4.h>
+#include <SystemWrapper.h>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+typedef ChemicalSynapsisModel<double> Gate;
+
+/*
+ * Slow activation of a chemical synapse under a constant presynaptic
+ * voltage, with rates fast enough to make it stiff. The solution is
+ * m(t) = m_inf + (m(0) - m_inf) exp(-t / tau), so errors are exact.
+ */
+template <typename Integrator>
+void gate(std::string const &name, double step) {
+  typedef DifferentialDynamicalSystemWrapper<SystemWrapper<Gate>, Integrator> System;
+
+  typename System::ConstructorArgs args;
+
+  args.params[Gate::v_pre] = -20;
+  args.params[Gate::k1] = 1000;
+  args.params[Gate::k2] = 500;
+  args.params[Gate::sslow] = 0.1;
+  args.params[Gate::Vslow] = -40;
+
+  System s(args);
+  s.set(Gate::mslow, 0);
+
+  const double a = args.params[Gate::k1] / (1 + std::exp(args.params[Gate::sslow] * (args.params[Gate::Vslow] - args.params[Gate::v_pre])));
+  const double rate = a + args.params[Gate::k2];
+  const double m_inf = a / rate;
+
+  const double time = 1;
+  double error = 0;
+
+  for (long n = 1; n <= std::lround(time / step); ++n) {
+    s.step(step);
+    error = std::max(error, std::abs(s.get(Gate::mslow) - m_inf * (1 - std::exp(-rate * n * step))));
+  }
+
+  std::cout << "  " << name << ": h * rate = " << step * rate << ", max error " << error << std::endl;
+}
+
+template <typename Integrator>
+double hodgkin_huxley(double step, double time) {
+  typedef DifferentialNeuronWrapper<SystemWrapper<HodgkinHuxleyModel<double>>, Integrator> Neuron;
+
+  typename Neuron::ConstructorArgs args;
+
+  args.params[Neuron::cm] = 1 * 7.854e-3;
+  args.params[Neuron::vna] = 50;
+  args.params[Neuron::vk] = -77;
+  args.params[Neuron::vl] = -54.387;
+  args.params[Neuron::gna] = 120 * 7.854e-3;
+  args.params[Neuron::gk] = 36 * 7.854e-3;
+  args.params[Neuron::gl] = 0.3 * 7.854e-3;
+
+  Neuron n(args);
+
+  n.set(Neuron::v, -65);
+  n.set(Neuron::m, 0.05);
+  n.set(Neuron::h, 0.6);
+  n.set(Neuron::n, 0.32);
+
+  for (long i = 0; i < std::lround(time / step); ++i) {
+    n.add_synaptic_input(0.08);
+    n.step(step);
+  }
+
+  return n.get(Neuron::v);
+}
+
+/*
+ * Integrates a stiff synaptic gate, whose model provides its Jacobian,
+ * with explicit integrators and with Rosenbrock2 at steps beyond the
+ * stability limit of the explicit ones. Then integrates a Hodgkin-Huxley
+ * neuron, whose Jacobian Rosenbrock2 approximates by finite differences,
+ * and compares the voltage after 20 ms with a fine RungeKutta4 solution.
+ */
+int main(int argc, char **argv) {
+  for (double step : {0.001, 0.01}) {
+    std::cout << "Synaptic gate, step " << step << ":" << std::endl;
+    gate<Euler>("Euler", step);
+    gate<RungeKutta4>("RungeKutta4", step);
+    gate<Rosenbrock2>("Rosenbrock2", step);
+  }
+
+  const double reference = hodgkin_huxley<RungeKutta4>(0.0001, 20);
+
+  std::cout << "Hodgkin-Huxley, v after 20 ms:" << std::endl;
+
+  for (double step : {0.01, 0.005, 0.0025}) {
+    std::cout << "  Rosenbrock2, step " << step << ": error "
+              << std::abs(hodgkin_huxley<Rosenbrock2>(step, 20) - reference) << " mV" << std::endl;
+  }
+
+  return 0;
+}
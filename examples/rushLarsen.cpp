@@ -0,0 +1,149 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DifferentialNeuronWrapper.h>
+#include <Euler.h>
+#include <HodgkinHuxleyModel.h>
+#include <RungeKutta4.h>
+#include <RushLarsen.h>
+#include <SystemWrapper.h>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+const double simulation_time = 200;
+
+/* Spike times (upward crossings of 0 mV) of a tonically firing neuron */
+template <typename Integrator>
+std::vector<double> spikes(double step, double &seconds, bool &bounded, bool &finite) {
+  typedef DifferentialNeuronWrapper<SystemWrapper<HodgkinHuxleyModel<double>>, Integrator> Neuron;
+
+  typename Neuron::ConstructorArgs args;
+
+  args.params[Neuron::cm] = 1 * 7.854e-3;
+  args.params[Neuron::vna] = 50;
+  args.params[Neuron::vk] = -77;
+  args.params[Neuron::vl] = -54.387;
+  args.params[Neuron::gna] = 120 * 7.854e-3;
+  args.params[Neuron::gk] = 36 * 7.854e-3;
+  args.params[Neuron::gl] = 0.3 * 7.854e-3;
+
+  Neuron n(args);
+
+  n.set(Neuron::v, -65);
+  n.set(Neuron::m, 0.05);
+  n.set(Neuron::h, 0.6);
+  n.set(Neuron::n, 0.32);
+
+  std::vector<double> times;
+  double last = n.get(Neuron::v);
+  bounded = finite = true;
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (long i = 1; i <= std::lround(simulation_time / step); ++i) {
+    n.add_synaptic_input(0.08);
+    n.step(step);
+
+    const double v = n.get(Neuron::v);
+
+    for (auto gate : {Neuron::m, Neuron::h, Neuron::n}) {
+      bounded = bounded && n.get(gate) >= 0 && n.get(gate) <= 1;
+    }
+
+    if (!std::isfinite(v)) {
+      finite = false;
+      break;
+    }
+
+    if (last < 0 && v >= 0) {
+      times.push_back((i - 1 + last / (last - v)) * step);
+    }
+
+    last = v;
+  }
+
+  seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  return times;
+}
+
+template <typename Integrator>
+void report(std::string const &name, double step, std::vector<double> const &reference) {
+  double seconds;
+  bool bounded, finite;
+  std::vector<double> times = spikes<Integrator>(step, seconds, bounded, finite);
+
+  std::cout << "  " << name << ": " << times.size() << " spikes";
+
+  if (times.size() == reference.size()) {
+    double error = 0;
+
+    for (std::size_t i = 0; i < times.size(); ++i) {
+      error = std::max(error, std::abs(times[i] - reference[i]));
+    }
+
+    std::cout << ", max spike time error " << error << " ms";
+  }
+
+  std::cout << ", gates in [0, 1]: " << (bounded ? "yes" : "no") << ", v finite: " << (finite ? "yes" : "no")
+            << ", " << seconds << " s" << std::endl;
+}
+
+/*
+ * Integrates a tonically firing Hodgkin-Huxley neuron with Euler and with
+ * RushLarsen at growing steps, and compares the spike times with those of
+ * a fine RungeKutta4 solution. At small steps Euler is the more accurate
+ * of the two. Around h = 0.08 ms Euler overshoots the gates out of [0, 1]
+ * and diverges, while RushLarsen keeps them bounded and only loses
+ * accuracy. The voltage is still explicit Euler, so RushLarsen diverges a
+ * little further on, once h exceeds the time constant of the membrane at
+ * the peak of the spike.
+ */
+int main(int argc, char **argv) {
+  double seconds;
+  bool bounded, finite;
+  const std::vector<double> reference = spikes<RungeKutta4>(0.001, seconds, bounded, finite);
+
+  std::cout << "RungeKutta4, step 0.001: " << reference.size() << " spikes" << std::endl;
+
+  for (double step : {0.01, 0.05, 0.07, 0.08, 0.1}) {
+    std::cout << "Step " << step << ":" << std::endl;
+    report<Euler>("Euler", step, reference);
+    report<RushLarsen>("RushLarsen", step, reference);
+  }
+
+  return 0;
+}
@@ -0,0 +1,174 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DifferentialNeuronWrapper.h>
+#include <RungeKutta4.h>
+#include <SharedParametersSystemWrapper.h>
+#include <SystemWrapper.h>
+#include <VavoulisCGCModelQ10Cached.h>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+typedef RungeKutta4 Integrator;
+typedef VavoulisCGCModelQ10Cached<double> Model;
+typedef DifferentialNeuronWrapper<SystemWrapper<Model>, Integrator> Neuron;
+typedef DifferentialNeuronWrapper<SharedParametersSystemWrapper<Model>, Integrator> SharedNeuron;
+
+// Gate parameters as vh, vs, tau0, delta, Q10
+static void set_gate(double *params, int first, double vh, double vs, double tau0,
+                     double delta, double q10) {
+  params[first] = vh;
+  params[first + 1] = vs;
+  params[first + 2] = tau0;
+  params[first + 3] = delta;
+  params[first + 4] = q10;
+}
+
+static void set_parameters(double *params) {
+  params[Model::t_scale] = 1;
+  params[Model::diff_T] = 5;
+  params[Model::cm] = 1;
+  params[Model::gamma_T] = 0.01;
+
+  params[Model::vna] = 55;
+  params[Model::vk] = -85;
+  params[Model::vca] = 120;
+
+  params[Model::Gnat] = 60;
+  params[Model::Gnap] = 0.2;
+  params[Model::Ga] = 4;
+  params[Model::Gd] = 15;
+  params[Model::Glva] = 0.1;
+  params[Model::Ghva] = 0.3;
+
+  params[Model::Q10_Gnat] = 1.5;
+  params[Model::Q10_Gnap] = 1.5;
+  params[Model::Q10_Ga] = 1.5;
+  params[Model::Q10_Gd] = 1.5;
+  params[Model::Q10_Glva] = 1.5;
+  params[Model::Q10_Ghva] = 1.5;
+
+  set_gate(params, Model::vh_h, -45, -10, 10, 0.5, 3);
+  set_gate(params, Model::vh_r, -50, 10, 5, 0.5, 3);
+  set_gate(params, Model::vh_a, -40, 12, 5, 0.5, 3);
+  set_gate(params, Model::vh_b, -70, -10, 30, 0.5, 3);
+  set_gate(params, Model::vh_n, -35, 12, 10, 0.5, 3);
+  set_gate(params, Model::vh_e, -20, 12, 5, 0.5, 3);
+  set_gate(params, Model::vh_f, -40, -12, 80, 0.5, 3);
+
+  params[Model::Vh_m] = -35;
+  params[Model::Vs_m] = 7;
+  params[Model::Vh_c] = -55;
+  params[Model::Vs_c] = 5;
+  params[Model::Vh_d] = -70;
+  params[Model::Vs_d] = -5;
+}
+
+// Starts every neuron at rest with its gates at their steady state
+template <typename N>
+static void rest(std::vector<N> &neurons, double const *params) {
+  const double v0 = -65;
+  const int gates[] = {Model::h, Model::r, Model::a, Model::b, Model::n, Model::e, Model::f};
+  const int first[] = {Model::vh_h, Model::vh_r, Model::vh_a, Model::vh_b, Model::vh_n, Model::vh_e, Model::vh_f};
+
+  for (N &n : neurons) {
+    n.set(Model::v, v0);
+
+    for (int i = 0; i < 7; ++i) {
+      n.set((Model::variable)gates[i], 1 / (1 + std::exp((params[first[i]] - v0) / params[first[i] + 1])));
+    }
+  }
+}
+
+template <typename N>
+static double run(std::vector<N> &neurons, double step, double simulation_time) {
+  auto start = std::chrono::steady_clock::now();
+
+  for (double time = 0; time < simulation_time; time += step) {
+    for (int i = 0; i < (int)neurons.size(); ++i) {
+      neurons[i].add_synaptic_input(1.5 + 1e-3 * (i % 1000));
+      neurons[i].step(step);
+    }
+  }
+
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*
+ * Integrates a population of neurons (first argument, 10000 by default)
+ * owning their parameters and the same population sharing one parameter
+ * block, with the conductance Gd overridden in every tenth neuron.
+ */
+int main(int argc, char **argv) {
+  const int size = argc > 1 ? std::atoi(argv[1]) : 10000;
+
+  Neuron::ConstructorArgs args;
+  set_parameters(args.params);
+
+  SharedNeuron::ConstructorArgs shared_args;
+  set_parameters(shared_args.params);
+  shared_args.share();
+
+  std::vector<Neuron> owning(size, Neuron(args));
+  std::vector<SharedNeuron> sharing(size, SharedNeuron(shared_args));
+
+  rest(owning, args.params);
+  rest(sharing, shared_args.params);
+
+  for (int i = 0; i < size; i += 10) {
+    owning[i].set(Model::Gd, 12);
+    sharing[i].set(Model::Gd, 12);
+  }
+
+  const double step = 0.01;
+  const double simulation_time = 10;
+
+  const double owning_time = run(owning, step, simulation_time);
+  const double sharing_time = run(sharing, step, simulation_time);
+
+  double max_diff = 0;
+  for (int i = 0; i < size; ++i) {
+    max_diff = std::max(max_diff, std::abs(owning[i].get(Model::v) - sharing[i].get(Model::v)));
+  }
+
+  std::cout << "Owning parameters:  " << sizeof(Neuron) << " bytes per neuron, "
+            << owning_time << " s" << std::endl;
+  std::cout << "Sharing parameters: " << sizeof(SharedNeuron) << " bytes per neuron, "
+            << sharing_time << " s" << std::endl;
+  std::cout << "Max voltage difference: " << max_diff << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,188 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DiffusionSynapsis.h>
+#include <DifferentialNeuronWrapper.h>
+#include <HodgkinHuxleyModel.h>
+#include <Network.h>
+#include <NeuronPopulation.h>
+#include <SynapseKinds.h>
+#include <SystemWrapper.h>
+#include <RungeKutta4.h>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+typedef RungeKutta4 Integrator;
+typedef DifferentialNeuronWrapper<SystemWrapper<HodgkinHuxleyModel<double>>, Integrator> HH;
+typedef DiffusionSynapsis<HH, HH, Integrator, double> Synapsis;
+
+typedef NeuronPopulation<HodgkinHuxleyModel<double>, Integrator> Population;
+typedef DiffusionSynapsisKind<double> Diffusion;
+typedef Network<Population, Integrator, Diffusion> Net;
+
+/*
+ * Random network of neurons (first argument, 1000 by default) with 20
+ * diffusion synapses each. Without delays, the network, where synapses
+ * are driven by spike events, is compared with synapsis objects polling
+ * the presynaptic voltage. Then the same network is run with delays of
+ * up to max_delay ms (second argument, 5 by default).
+ */
+int main(int argc, char **argv) {
+  const int neurons = argc > 1 ? std::atoi(argv[1]) : 1000;
+  const double max_delay = argc > 2 ? std::atof(argv[2]) : 5;
+  const int fanin = 20;
+
+  HH::ConstructorArgs args;
+
+  args.params[HH::cm] = 1 * 7.854e-3;
+  args.params[HH::vna] = 50;
+  args.params[HH::vk] = -77;
+  args.params[HH::vl] = -54.387;
+  args.params[HH::gna] = 120 * 7.854e-3;
+  args.params[HH::gk] = 36 * 7.854e-3;
+  args.params[HH::gl] = 0.3 * 7.854e-3;
+
+  Synapsis::ConstructorArgs syn_args;
+  syn_args.params[Synapsis::alpha] = 1.1;
+  syn_args.params[Synapsis::beta] = 0.19;
+  syn_args.params[Synapsis::threshold] = 0;
+  syn_args.params[Synapsis::esyn] = 0;
+  syn_args.params[Synapsis::gsyn] = -0.0005;
+  syn_args.params[Synapsis::T] = 1;
+  syn_args.params[Synapsis::max_release_time] = 1;
+
+  const double step = 0.01;
+  const double simulation_time = 100;
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> pick(0, neurons - 1);
+  std::uniform_int_distribution<int> delay(0, max_delay / step);
+
+  std::vector<Net::group_type<Diffusion>::connection> connections;
+
+  for (int post = 0; post < neurons; ++post) {
+    for (int k = 0; k < fanin; ++k) {
+      connections.push_back({pick(rng), post, 1});
+    }
+  }
+
+  std::stable_sort(connections.begin(), connections.end(),
+                   [](auto const &a, auto const &b) { return a.pre < b.pre; });
+
+  std::vector<HH> wrappers(neurons, HH(args));
+  std::vector<Synapsis> synapses;
+  synapses.reserve(connections.size());
+
+  for (auto const &c : connections) {
+    synapses.emplace_back(wrappers[c.pre], HH::v, wrappers[c.post], HH::v, syn_args, 1);
+  }
+
+  Population::ConstructorArgs population_args;
+  std::copy(args.params, args.params + HH::n_parameters, population_args.params);
+
+  Diffusion::ConstructorArgs diffusion_args;
+  std::copy(syn_args.params, syn_args.params + Synapsis::n_parameters, diffusion_args.params);
+
+  Net network, delayed;
+  network.add_population(neurons, population_args);
+  delayed.add_population(neurons, population_args);
+  network.connect<Diffusion>(0, HH::v, 0, HH::v, connections, diffusion_args);
+
+  for (auto &c : connections) {
+    c.delay = delay(rng);
+  }
+
+  delayed.connect<Diffusion>(0, HH::v, 0, HH::v, connections, diffusion_args);
+
+  for (int i = 0; i < neurons; ++i) {
+    wrappers[i].set(HH::v, -75 + 0.01 * i);
+    network.population(0).set(i, HH::v, -75 + 0.01 * i);
+    delayed.population(0).set(i, HH::v, -75 + 0.01 * i);
+  }
+
+  auto input = [](int i) { return 0.08 + 1e-4 * (i % 200); };
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (double time = 0; time < simulation_time; time += step) {
+    for (Synapsis &s : synapses) {
+      s.step(step);
+    }
+
+    for (int i = 0; i < neurons; ++i) {
+      wrappers[i].add_synaptic_input(input(i));
+      wrappers[i].step(step);
+    }
+  }
+
+  auto middle = std::chrono::steady_clock::now();
+
+  for (double time = 0; time < simulation_time; time += step) {
+    for (int i = 0; i < neurons; ++i) {
+      network.population(0).add_synaptic_input(i, input(i));
+    }
+
+    network.step(step);
+  }
+
+  auto end = std::chrono::steady_clock::now();
+
+  double max_diff = 0, max_delayed_diff = 0;
+
+  for (int i = 0; i < neurons; ++i) {
+    max_diff = std::max(max_diff, std::abs(wrappers[i].get(HH::v) - network.population(0).get(i, HH::v)));
+  }
+
+  for (double time = 0; time < simulation_time; time += step) {
+    for (int i = 0; i < neurons; ++i) {
+      delayed.population(0).add_synaptic_input(i, input(i));
+    }
+
+    delayed.step(step);
+  }
+
+  for (int i = 0; i < neurons; ++i) {
+    max_delayed_diff = std::max(max_delayed_diff, std::abs(delayed.population(0).get(i, HH::v) - network.population(0).get(i, HH::v)));
+  }
+
+  std::cout << "Polling objects: " << std::chrono::duration<double>(middle - start).count() << " s" << std::endl;
+  std::cout << "Spike events:    " << std::chrono::duration<double>(end - middle).count() << " s" << std::endl;
+  std::cout << "Max difference in v: " << max_diff << std::endl;
+  std::cout << "Max difference in v with delays: " << max_delayed_diff << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,155 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <AdditiveNoiseWrapper.h>
+#include <DifferentialNeuronWrapper.h>
+#include <EulerMaruyama.h>
+#include <HodgkinHuxleyModel.h>
+#include <Milstein.h>
+#include <StochasticHeun.h>
+#include <SystemWrapper.h>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef AdditiveNoiseWrapper<SystemWrapper<HodgkinHuxleyModel<double>>> Noisy;
+
+const int neurons = 3;
+const double step = 0.01;
+const int steps = 20000;
+
+/*
+ * Runs copies of a Hodgkin-Huxley neuron with additive current noise,
+ * each given its own noise stream, and returns the voltage traces.
+ */
+template <typename Integrator>
+std::vector<std::vector<double>> simulate(std::uint32_t seed) {
+  typedef DifferentialNeuronWrapper<Noisy, Integrator> Neuron;
+
+  typename Neuron::ConstructorArgs args;
+
+  args.params[Neuron::cm] = 1 * 7.854e-3;
+  args.params[Neuron::vna] = 50;
+  args.params[Neuron::vk] = -77;
+  args.params[Neuron::vl] = -54.387;
+  args.params[Neuron::gna] = 120 * 7.854e-3;
+  args.params[Neuron::gk] = 36 * 7.854e-3;
+  args.params[Neuron::gl] = 0.3 * 7.854e-3;
+
+  Neuron prototype(args);
+
+  prototype.set(Neuron::v, -65);
+  prototype.set(Neuron::m, 0.05);
+  prototype.set(Neuron::h, 0.6);
+  prototype.set(Neuron::n, 0.32);
+
+  // A current noise of 0.02 is 0.02 / cm on v
+  prototype.set_noise(Neuron::v, 0.02 / args.params[Neuron::cm]);
+
+  // Copies keep the stream of the prototype, so each is keyed on its own
+  std::vector<Neuron> population(neurons, prototype);
+
+  for (int i = 0; i < neurons; ++i) {
+    population[i].integrator_state().key(i, seed);
+  }
+
+  std::vector<std::vector<double>> traces(neurons);
+
+  for (int n = 0; n < steps; ++n) {
+    for (int i = 0; i < neurons; ++i) {
+      population[i].add_synaptic_input(0.04);
+      population[i].step(step);
+      traces[i].push_back(population[i].get(Neuron::v));
+    }
+  }
+
+  return traces;
+}
+
+template <typename Integrator>
+void report(std::string const &name) {
+  std::vector<std::vector<double>> traces = simulate<Integrator>(1);
+  std::vector<std::vector<double>> again = simulate<Integrator>(1);
+  std::vector<std::vector<double>> reseeded = simulate<Integrator>(2);
+
+  std::cout << name << std::endl;
+
+  for (int i = 0; i < neurons; ++i) {
+    int spikes = 0;
+    double mean = 0, squares = 0;
+
+    for (int n = 0; n < steps; ++n) {
+      spikes += n > 0 && traces[i][n - 1] < 0 && traces[i][n] >= 0;
+      mean += traces[i][n] / steps;
+      squares += traces[i][n] * traces[i][n] / steps;
+    }
+
+    std::cout << "  neuron " << i << ": " << spikes << " spikes, v " << mean << " +- "
+              << std::sqrt(squares - mean * mean) << std::endl;
+  }
+
+  auto same = [](std::vector<double> const &a, std::vector<double> const &b) {
+    return std::memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0;
+  };
+
+  bool reproduced = true, distinct = true, reseeded_differs = true;
+
+  for (int i = 0; i < neurons; ++i) {
+    reproduced = reproduced && same(traces[i], again[i]);
+    reseeded_differs = reseeded_differs && !same(traces[i], reseeded[i]);
+
+    for (int j = 0; j < i; ++j) {
+      distinct = distinct && !same(traces[i], traces[j]);
+    }
+  }
+
+  std::cout << "  same keys reproduce the traces: " << (reproduced ? "yes" : "no") << std::endl;
+  std::cout << "  neurons draw different noise: " << (distinct ? "yes" : "no") << std::endl;
+  std::cout << "  another seed changes the noise: " << (reseeded_differs ? "yes" : "no") << std::endl;
+}
+
+/*
+ * Integrates noisy Hodgkin-Huxley neurons near threshold with each of the
+ * stochastic integrators, and checks that the noise of every neuron is its
+ * own and only depends on its key. With additive noise Milstein reduces to
+ * EulerMaruyama and gives the same traces.
+ */
+int main(int argc, char **argv) {
+  report<EulerMaruyama>("EulerMaruyama");
+  report<Milstein>("Milstein");
+  report<StochasticHeun>("StochasticHeun");
+
+  return 0;
+}
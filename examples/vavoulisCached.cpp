@@ -0,0 +1,161 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#include <DifferentialNeuronWrapper.h>
+#include <RungeKutta4.h>
+#include <SystemWrapper.h>
+#include <VavoulisCGCModelQ10.h>
+#include <VavoulisCGCModelQ10Cached.h>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+typedef RungeKutta4 Integrator;
+typedef DifferentialNeuronWrapper<SystemWrapper<VavoulisCGCModelQ10<double>>, Integrator> Neuron;
+typedef DifferentialNeuronWrapper<SystemWrapper<VavoulisCGCModelQ10Cached<double>>, Integrator> CachedNeuron;
+
+// Gate parameters as vh, vs, tau0, delta, Q10
+static void set_gate(Neuron::ConstructorArgs &args, int first, double vh, double vs,
+                     double tau0, double delta, double q10) {
+  args.params[first] = vh;
+  args.params[first + 1] = vs;
+  args.params[first + 2] = tau0;
+  args.params[first + 3] = delta;
+  args.params[first + 4] = q10;
+}
+
+/*
+ * Integrates the same neuron with VavoulisCGCModelQ10 and with its cached
+ * variant, prints both voltage traces and reports the time taken by each
+ * and the largest difference between them.
+ */
+int main(int argc, char **argv) {
+  Neuron::ConstructorArgs args;
+
+  args.params[Neuron::t_scale] = 1;
+  args.params[Neuron::diff_T] = 5;
+  args.params[Neuron::cm] = 1;
+  args.params[Neuron::gamma_T] = 0.01;
+
+  args.params[Neuron::vna] = 55;
+  args.params[Neuron::vk] = -85;
+  args.params[Neuron::vca] = 120;
+
+  args.params[Neuron::Gnat] = 60;
+  args.params[Neuron::Gnap] = 0.2;
+  args.params[Neuron::Ga] = 4;
+  args.params[Neuron::Gd] = 15;
+  args.params[Neuron::Glva] = 0.1;
+  args.params[Neuron::Ghva] = 0.3;
+
+  args.params[Neuron::Q10_Gnat] = 1.5;
+  args.params[Neuron::Q10_Gnap] = 1.5;
+  args.params[Neuron::Q10_Ga] = 1.5;
+  args.params[Neuron::Q10_Gd] = 1.5;
+  args.params[Neuron::Q10_Glva] = 1.5;
+  args.params[Neuron::Q10_Ghva] = 1.5;
+
+  set_gate(args, Neuron::vh_h, -45, -10, 10, 0.5, 3);
+  set_gate(args, Neuron::vh_r, -50, 10, 5, 0.5, 3);
+  set_gate(args, Neuron::vh_a, -40, 12, 5, 0.5, 3);
+  set_gate(args, Neuron::vh_b, -70, -10, 30, 0.5, 3);
+  set_gate(args, Neuron::vh_n, -35, 12, 10, 0.5, 3);
+  set_gate(args, Neuron::vh_e, -20, 12, 5, 0.5, 3);
+  set_gate(args, Neuron::vh_f, -40, -12, 80, 0.5, 3);
+
+  args.params[Neuron::Vh_m] = -35;
+  args.params[Neuron::Vs_m] = 7;
+  args.params[Neuron::Vh_c] = -55;
+  args.params[Neuron::Vs_c] = 5;
+  args.params[Neuron::Vh_d] = -70;
+  args.params[Neuron::Vs_d] = -5;
+
+  CachedNeuron::ConstructorArgs cached_args;
+  std::copy(args.params, args.params + Neuron::n_parameters, cached_args.params);
+
+  Neuron n(args);
+  CachedNeuron c(cached_args);
+
+  // Start at rest, with every gate at its steady state
+  const double v0 = -65;
+  const int gates[] = {Neuron::h, Neuron::r, Neuron::a, Neuron::b, Neuron::n, Neuron::e, Neuron::f};
+  const int first[] = {Neuron::vh_h, Neuron::vh_r, Neuron::vh_a, Neuron::vh_b, Neuron::vh_n, Neuron::vh_e, Neuron::vh_f};
+
+  n.set(Neuron::v, v0);
+  c.set(CachedNeuron::v, v0);
+
+  for (int i = 0; i < 7; ++i) {
+    double inf = 1 / (1 + std::exp((args.params[first[i]] - v0) / args.params[first[i] + 1]));
+
+    n.set((Neuron::variable)gates[i], inf);
+    c.set((CachedNeuron::variable)gates[i], inf);
+  }
+
+  const double step = 0.01;
+  const double simulation_time = 2000;
+  const long steps = simulation_time / step;
+
+  double *vn = new double[steps];
+  double *vc = new double[steps];
+
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < steps; ++i) {
+    n.add_synaptic_input(2);
+    n.step(step);
+    vn[i] = n.get(Neuron::v);
+  }
+  auto middle = std::chrono::steady_clock::now();
+  for (long i = 0; i < steps; ++i) {
+    c.add_synaptic_input(2);
+    c.step(step);
+    vc[i] = c.get(CachedNeuron::v);
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double max_diff = 0;
+  for (long i = 0; i < steps; ++i) {
+    std::cout << i * step << " " << vn[i] << " " << vc[i] << "\n";
+    max_diff = std::max(max_diff, std::abs(vn[i] - vc[i]));
+  }
+
+  std::cerr << "VavoulisCGCModelQ10: "
+            << std::chrono::duration<double>(middle - start).count() << " s\n"
+            << "VavoulisCGCModelQ10Cached: "
+            << std::chrono::duration<double>(end - middle).count() << " s\n"
+            << "Max voltage difference: " << max_diff << std::endl;
+
+  delete[] vn;
+  delete[] vc;
+
+  return 0;
+}
@@ -0,0 +1,218 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef CHECKPOINT_H_
+#define CHECKPOINT_H_
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Binary checkpoints, restored bit for bit.
+ *
+ * Values are written with their in-memory representation, so a checkpoint
+ * can only be read on a machine with the same byte order and types.
+ * A file starts with a header naming the format and its version, and each
+ * object then writes its sizes before its data so that restoring into an
+ * object built differently fails instead of misreading the rest.
+ *
+ * Objects provide save(std::ostream &) const and load(std::istream &),
+ * which read and write their own data without the header. Errors are
+ * reported with std::runtime_error.
+ */
+namespace neun::checkpoint {
+
+constexpr char magic[8] = {'N', 'E', 'U', 'N', 'C', 'K', 'P', 'T'};
+constexpr std::uint32_t version = 1;
+
+template <typename T>
+void write(std::ostream &os, T const *values, std::size_t n) {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+  os.write(reinterpret_cast<char const *>(values), n * sizeof(T));
+}
+
+template <typename T>
+void write(std::ostream &os, T const &value) {
+  write(os, &value, 1);
+}
+
+template <typename T>
+void read(std::istream &is, T *values, std::size_t n) {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+  if (!is.read(reinterpret_cast<char *>(values), n * sizeof(T))) {
+    throw std::runtime_error("checkpoint: unexpected end of data");
+  }
+}
+
+template <typename T>
+void read(std::istream &is, T &value) {
+  read(is, &value, 1);
+}
+
+/* Writes a size that expect() will check when reading */
+inline void write_size(std::ostream &os, std::size_t n) {
+  write(os, static_cast<std::uint64_t>(n));
+}
+
+inline void expect(std::istream &is, std::size_t n, char const *what) {
+  std::uint64_t stored;
+  read(is, stored);
+
+  if (stored != n) {
+    throw std::runtime_error(std::string("checkpoint: ") + what + " is " + std::to_string(stored) +
+                             ", expected " + std::to_string(n));
+  }
+}
+
+/* Writes the elements of a contiguous array, such as std::vector */
+template <typename Array>
+void write_vector(std::ostream &os, Array const &values) {
+  write_size(os, values.size());
+  write(os, values.data(), values.size());
+}
+
+/* Reads a vector of any length, use expect() first if it is known */
+template <typename T>
+void read_vector(std::istream &is, std::vector<T> &values) {
+  std::uint64_t n;
+  read(is, n);
+  values.resize(n);
+  read(is, values.data(), n);
+}
+
+/* Sizes of a system, checked so that a state is only loaded into its own type */
+template <typename precission_t>
+void write_shape(std::ostream &os, int n_variables, int n_parameters) {
+  write_size(os, sizeof(precission_t));
+  write_size(os, n_variables);
+  write_size(os, n_parameters);
+}
+
+template <typename precission_t>
+void expect_shape(std::istream &is, int n_variables, int n_parameters) {
+  expect(is, sizeof(precission_t), "size of precission_t");
+  expect(is, n_variables, "number of variables");
+  expect(is, n_parameters, "number of parameters");
+}
+
+/**
+ * Integrator and precision states are saved with their own save and load
+ * when they have them, and as they are when trivially copyable. Otherwise
+ * (e.g. they hold pointers) they are reset on load, as after a set(), and
+ * the next step starts them again.
+ */
+template <typename State>
+void write_state(std::ostream &os, State const &state) {
+  if constexpr (requires { state.save(os); }) {
+    state.save(os);
+  } else if constexpr (!std::is_empty_v<State> && std::is_trivially_copyable_v<State>) {
+    write(os, state);
+  }
+}
+
+template <typename State>
+void read_state(std::istream &is, State &state) {
+  if constexpr (requires { state.load(is); }) {
+    state.load(is);
+  } else if constexpr (std::is_empty_v<State>) {
+    return;
+  } else if constexpr (std::is_trivially_copyable_v<State>) {
+    read(is, state);
+  } else {
+    state.reset();
+  }
+}
+
+inline void write_header(std::ostream &os) {
+  os.write(magic, sizeof(magic));
+  write(os, version);
+}
+
+inline void read_header(std::istream &is) {
+  char stored[sizeof(magic)];
+  std::uint32_t stored_version;
+
+  read(is, stored, sizeof(stored));
+
+  if (std::memcmp(stored, magic, sizeof(magic)) != 0) {
+    throw std::runtime_error("checkpoint: not a checkpoint");
+  }
+
+  read(is, stored_version);
+
+  if (stored_version != version) {
+    throw std::runtime_error("checkpoint: unsupported version " + std::to_string(stored_version));
+  }
+}
+
+/* Writes a header followed by each object in turn */
+template <typename... Objects>
+void save(std::string const &path, Objects const &...objects) {
+  std::ofstream os(path, std::ios::binary);
+
+  if (!os) {
+    throw std::runtime_error("checkpoint: cannot open " + path);
+  }
+
+  write_header(os);
+  (objects.save(os), ...);
+
+  if (!os.flush()) {
+    throw std::runtime_error("checkpoint: cannot write " + path);
+  }
+}
+
+/* Restores objects saved by save(path, objects...), in the same order */
+template <typename... Objects>
+void load(std::string const &path, Objects &...objects) {
+  std::ifstream is(path, std::ios::binary);
+
+  if (!is) {
+    throw std::runtime_error("checkpoint: cannot open " + path);
+  }
+
+  read_header(is);
+  (objects.load(is), ...);
+}
+
+}  // namespace neun::checkpoint
+
+#endif /*CHECKPOINT_H_*/
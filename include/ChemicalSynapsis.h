@@ -42,6 +42,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif  //__AVR_ARCH__
 
 #include "ChemicalSynapsisModel.h"
+#include "MultiRate.h"
 #include "IntegratedSystemWrapper.h"
 #include "SerializableWrapper.h"
 #include "SystemWrapper.h"
@@ -81,6 +82,8 @@ class ChemicalSynapsis
 
   const int m_steps;
 
+  MultiRate<precission> m_rate;
+
  public:
   typedef typename System::precission_t precission_t;
   typedef typename System::variable variable;
@@ -98,16 +101,20 @@ class ChemicalSynapsis
    * @param pT Concentration of neurotransmitter at release time
    * @param pmax_release_time Width of the pulse at which neurotransmitter is
    * released
+   * @param slow_rate The slow activation is integrated once every slow_rate
+   * calls to step, with the mean presynaptic voltage of those calls. The
+   * current is updated on every call.
    */
   ChemicalSynapsis(TNode1 const &n1, typename TNode1::variable v, TNode2 &n2,
                     typename TNode2::variable v2, ConstructorArgs &args,
-                    int steps)
-      : m_n1(n1),
+                    int steps, int slow_rate = 1)
+      : System(args),
+        m_n1(n1),
         m_n2(n2),
         m_n1_variable(v),
         m_n2_variable(v2),
-        System(args),
-        m_steps(steps) {
+        m_steps(steps),
+        m_rate(slow_rate) {
           for(int i=0; i < System::n_variables; i++)
           {
             System::m_variables[i] = 0;
@@ -116,13 +123,14 @@ class ChemicalSynapsis
 
   ChemicalSynapsis(TNode1 const &n1, typename TNode1::variable v, TNode2 &n2,
                     typename TNode2::variable v2, ConstructorArgs &&args,
-                    int steps)
-      : m_n1(n1),
+                    int steps, int slow_rate = 1)
+      : System(args),
+        m_n1(n1),
         m_n2(n2),
         m_n1_variable(v),
         m_n2_variable(v2),
-        System(args),
-        m_steps(steps) {
+        m_steps(steps),
+        m_rate(slow_rate) {
           for(int i=0; i < System::n_variables; i++)
           {
             System::m_variables[i] = 0;
@@ -132,23 +140,40 @@ class ChemicalSynapsis
 
   ChemicalSynapsis(TNode1 const &n1, TNode2 &n2,
                     ChemicalSynapsis const &synapse)
-      : m_n1(n1),
+      : System(synapse),
+        m_n1(n1),
         m_n2(n2),
         m_n1_variable(synapse.m_n1_variable),
         m_n2_variable(synapse.m_n2_variable),
         m_steps(synapse.m_steps),
-        System(synapse) {}
+        m_rate(synapse.m_rate) {}
   
   // TODO include a constructor without neurons for precission voltage input only
 
+ private:
+  void step_slow(precission h) {
+    precission v_pre = System::m_parameters[System::v_pre];
+
+    if (m_rate.sample(v_pre)) {
+      System::m_parameters[System::v_pre] = m_rate.mean();
+
+      for (int i = 0; i < m_steps; ++i) {
+        TIntegrator::step(*this, m_rate.ratio() * h, System::m_variables, System::m_parameters);
+      }
+
+      m_rate.restart();
+      System::m_parameters[System::v_pre] = v_pre;
+    }
+  }
+
+ public:
+
   void step(precission h) {
     //Vpre parameter updated from Presynaptic neuron value (must be defined in synapsisModel params)
     System::m_parameters[System::v_pre]=m_n1.get(m_n1_variable); 
     precission v_post = m_n2.get(m_n2_variable);
 
-    for (int i = 0; i < m_steps; ++i) {
-      TIntegrator::step(*this, h, System::m_variables, System::m_parameters);
-    }
+    step_slow(h);
 
     /* (Golowasch, 1999) */
     System::m_parameters[System::ifast] = (System::m_parameters[System::gfast] * (v_post - System::m_parameters[System::Esyn])) /
@@ -166,9 +191,7 @@ class ChemicalSynapsis
     System::m_parameters[System::v_pre]= vpre;
     precission v_post = vpost;
 
-    for (int i = 0; i < m_steps; ++i) {
-      TIntegrator::step(*this, h, System::m_variables, System::m_parameters);
-    }
+    step_slow(h);
 
     /* (Golowasch, 1999) */
     System::m_parameters[System::ifast] = (System::m_parameters[System::gfast] * (v_post - System::m_parameters[System::Esyn])) /
@@ -179,6 +202,17 @@ class ChemicalSynapsis
     
     System::m_parameters[System::i] = System::m_parameters[System::ifast]+System::m_parameters[System::islow];
   }
+
+  /* Also saves the slow window in progress, see Checkpoint.h */
+  void save(std::ostream &os) const {
+    System::save(os);
+    m_rate.save(os);
+  }
+
+  void load(std::istream &is) {
+    System::load(is);
+    m_rate.load(is);
+  }
 };
 
 #endif /*CHEMICAL_SYNAPSIS_H_*/
@@ -99,12 +99,12 @@ class DiffusionSynapsis
   DiffusionSynapsis(TNode1 const &n1, typename TNode1::variable v, TNode2 &n2,
                     typename TNode2::variable v2, ConstructorArgs &args,
                     int steps)
-      : m_release_time(0),
+      : System(args),
+        m_release_time(0),
         m_n1(n1),
         m_n2(n2),
         m_n1_variable(v),
         m_n2_variable(v2),
-        System(args),
         m_steps(steps) {
     System::m_variables[System::r] = 0;
     System::m_variables[System::i] = 0;
@@ -113,12 +113,12 @@ class DiffusionSynapsis
   DiffusionSynapsis(TNode1 const &n1, typename TNode1::variable v, TNode2 &n2,
                     typename TNode2::variable v2, ConstructorArgs &&args,
                     int steps)
-      : m_release_time(0),
+      : System(args),
+        m_release_time(0),
         m_n1(n1),
         m_n2(n2),
         m_n1_variable(v),
         m_n2_variable(v2),
-        System(args),
         m_steps(steps) {
     System::m_variables[System::r] = 0;
     System::m_variables[System::i] = 0;
@@ -126,14 +126,14 @@ class DiffusionSynapsis
 
   DiffusionSynapsis(TNode1 const &n1, TNode2 &n2,
                     DiffusionSynapsis const &synapse)
-      : m_release_time(synapse.m_release_time),
-        m_last_value_pre(synapse.m_last_value_pre),
+      : System(synapse),
+        m_release_time(synapse.m_release_time),
         m_n1(n1),
         m_n2(n2),
+        m_last_value_pre(synapse.m_last_value_pre),
         m_n1_variable(synapse.m_n1_variable),
         m_n2_variable(synapse.m_n2_variable),
-        m_steps(synapse.m_steps),
-        System(synapse) {}
+        m_steps(synapse.m_steps) {}
 
   void step(precission h) {
     for (int i = 0; i < m_steps; ++i) {
@@ -166,6 +166,21 @@ class DiffusionSynapsis
 
     m_n2.add_synaptic_input(System::m_variables[System::i]);
   }
+
+  /* Also saves the release in progress, see Checkpoint.h */
+  void save(std::ostream &os) const {
+    System::save(os);
+    neun::checkpoint::write(os, System::m_release);
+    neun::checkpoint::write(os, m_release_time);
+    neun::checkpoint::write(os, m_last_value_pre);
+  }
+
+  void load(std::istream &is) {
+    System::load(is);
+    neun::checkpoint::read(is, System::m_release);
+    neun::checkpoint::read(is, m_release_time);
+    neun::checkpoint::read(is, m_last_value_pre);
+  }
 };
 
 #endif /*DIFFUSIONSYNAPSIS_H_*/
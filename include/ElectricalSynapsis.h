@@ -39,6 +39,7 @@ $Id: ElectricalSynapsis.h 184 2007-06-04 11:26:12Z elferdo $
 #include <iostream>
 #include <type_traits>
 
+#include "Checkpoint.h"
 #include "NeuronConcept.h"
 
 /**
@@ -109,16 +110,17 @@ class ElectricalSynapsis {
 
   void set(parameter param, precission_t value) { m_parameters[param] = value; }
 
-  void save(std::ostream &os) {
-    for (int i = 0; i < n_variables; i++) {
-      os << m_variables[i] << " ";
-    }
+  /* Binary, see Checkpoint.h. The neurons are saved on their own */
+  void save(std::ostream &os) const {
+    neun::checkpoint::write_shape<precission>(os, n_variables, n_parameters);
+    neun::checkpoint::write(os, m_variables, n_variables);
+    neun::checkpoint::write(os, m_parameters, n_parameters);
   }
 
   void load(std::istream &is) {
-    for (int i = 0; i < n_variables; i++) {
-      is >> m_variables[i];
-    }
+    neun::checkpoint::expect_shape<precission>(is, n_variables, n_parameters);
+    neun::checkpoint::read(is, m_variables, n_variables);
+    neun::checkpoint::read(is, m_parameters, n_parameters);
   }
 };
 
@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif  //__AVR_ARCH__
 
 #include "GradualActivationSynapsisModel.h"
+#include "MultiRate.h"
 #include "IntegratedSystemWrapper.h"
 #include "SerializableWrapper.h"
 #include "SystemWrapper.h"
@@ -53,7 +54,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 template <typename TNode1, typename TNode2, typename TIntegrator,
           typename precission = double>
 requires NeuronConcept<TNode1> && NeuronConcept<TNode2> &&
-    IntegratorConcept<TIntegrator>
+    IntegratorConcept<TIntegrator, SerializableWrapper<
+          SystemWrapper<GradualActivationSynapsisModel<precission> > > >
 class GradualActivationSynapsis
     : public SerializableWrapper<
           SystemWrapper<GradualActivationSynapsisModel<precission> > > {
@@ -78,6 +80,8 @@ class GradualActivationSynapsis
 
   const int m_steps;
 
+  MultiRate<precission> m_rate;
+
  public:
   typedef typename System::precission_t precission_t;
   typedef typename System::variable variable;
@@ -95,16 +99,20 @@ class GradualActivationSynapsis
    * @param pT Concentration of neurotransmitter at release time
    * @param pmax_release_time Width of the pulse at which neurotransmitter is
    * released
+   * @param slow_rate The activation is integrated once every slow_rate calls
+   * to step, with the mean presynaptic voltage of those calls. The current
+   * is updated on every call.
    */
   GradualActivationSynapsis(TNode1 const &n1, typename TNode1::variable v, TNode2 &n2,
                     typename TNode2::variable v2, ConstructorArgs &args,
-                    int steps)
-      : m_n1(n1),
+                    int steps, int slow_rate = 1)
+      : System(args),
+        m_n1(n1),
         m_n2(n2),
         m_n1_variable(v),
         m_n2_variable(v2),
-        System(args),
-        m_steps(steps) {
+        m_steps(steps),
+        m_rate(slow_rate) {
     System::m_variables[System::r] = 0;
     System::m_variables[System::s] = 0;
     System::m_variables[System::i] = 0;
@@ -112,13 +120,14 @@ class GradualActivationSynapsis
 
   GradualActivationSynapsis(TNode1 const &n1, typename TNode1::variable v, TNode2 &n2,
                     typename TNode2::variable v2, ConstructorArgs &&args,
-                    int steps)
-      : m_n1(n1),
+                    int steps, int slow_rate = 1)
+      : System(args),
+        m_n1(n1),
         m_n2(n2),
         m_n1_variable(v),
         m_n2_variable(v2),
-        System(args),
-        m_steps(steps) {
+        m_steps(steps),
+        m_rate(slow_rate) {
     System::m_variables[System::r] = 0;
     System::m_variables[System::s] = 0;
     System::m_variables[System::i] = 0;
@@ -126,21 +135,30 @@ class GradualActivationSynapsis
 
   GradualActivationSynapsis(TNode1 const &n1, TNode2 &n2,
                     GradualActivationSynapsis const &synapse)
-      : m_n1(n1),
+      : System(synapse),
+        m_n1(n1),
         m_n2(n2),
         m_n1_variable(synapse.m_n1_variable),
         m_n2_variable(synapse.m_n2_variable),
         m_steps(synapse.m_steps),
-        System(synapse) {}
+        m_rate(synapse.m_rate) {}
 
   void step(precission h) {
     //Vpre parameter updated from Presynaptic neuron value.
-    System::m_parameters[System::v_pre]=m_n1.get(m_n1_variable); 
+    precission v_pre = m_n1.get(m_n1_variable);
+
+    if (m_rate.sample(v_pre)) {
+      System::m_parameters[System::v_pre] = m_rate.mean();
 
-    for (int i = 0; i < m_steps; ++i) {
-      TIntegrator::step(*this, h, System::m_variables, System::m_parameters);
+      for (int i = 0; i < m_steps; ++i) {
+        TIntegrator::step(*this, m_rate.ratio() * h, System::m_variables, System::m_parameters);
+      }
+
+      m_rate.restart();
     }
 
+    System::m_parameters[System::v_pre] = v_pre;
+
     /* (Vavoulis, 2007) */
     System::m_variables[System::i] =
         System::m_parameters[System::gsyn] * System::m_variables[System::s] *
@@ -148,6 +166,17 @@ class GradualActivationSynapsis
 
     m_n2.add_synaptic_input(System::m_variables[System::i]);
   }
+
+  /* Also saves the slow window in progress, see Checkpoint.h */
+  void save(std::ostream &os) const {
+    System::save(os);
+    m_rate.save(os);
+  }
+
+  void load(std::istream &is) {
+    System::load(is);
+    m_rate.load(is);
+  }
 };
 
 #endif /*GRADUAL_ACTIVATION_SYNAPSIS_H_*/
@@ -0,0 +1,215 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef MAPPEDSTATE_H_
+#define MAPPEDSTATE_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "Checkpoint.h"
+
+/**
+ * @brief The state of a system (e.g. a Network or a NeuronPopulation) kept
+ * in a memory mapped file.
+ *
+ * Created from a system, the file receives its state and the system
+ * carries on working on the file; sync() then takes a snapshot by flushing
+ * it, instead of serialising. Opened on an existing file, a system built
+ * the same way starts from the snapshot by mapping it: pages are only read
+ * as the system touches them, so warmed-up states are reused at once.
+ * Opened copy_on_write, the changes stay private to the process and the
+ * snapshot can serve many variants (e.g. of the parameters, which are not
+ * part of the state).
+ *
+ * The file holds a header, the state as laid out by place_state, and then
+ * the events in flight (see Network::save_events) in the format of
+ * Checkpoint.h. It can only be read on a machine with the same types and
+ * byte order, and must be mapped for as long as the system uses it.
+ *
+ * Systems provide state_bytes(), place_state(std::byte *),
+ * adopt_state(std::byte *), save_events(std::ostream &) and
+ * load_events(std::istream &). POSIX only.
+ */
+class MappedState {
+ public:
+  enum mode { shared, copy_on_write };
+
+ private:
+  /* The state starts here, aligned as StateArray expects */
+  static constexpr std::size_t header_bytes = 64;
+
+  std::string m_path;
+  mode m_mode;
+  int m_fd;
+  std::byte *m_memory;
+  std::size_t m_length;
+
+  [[noreturn]] void fail(std::string const &what) {
+    release();
+    throw std::runtime_error("mapped state: " + what + " " + m_path);
+  }
+
+  void map() {
+    void *memory = mmap(nullptr, m_length, PROT_READ | PROT_WRITE,
+                        m_mode == shared ? MAP_SHARED : MAP_PRIVATE, m_fd, 0);
+
+    if (memory == MAP_FAILED) {
+      fail("cannot map");
+    }
+
+    m_memory = static_cast<std::byte *>(memory);
+  }
+
+  void release() {
+    if (m_memory != nullptr) {
+      munmap(m_memory, m_length);
+      m_memory = nullptr;
+    }
+
+    if (m_fd >= 0) {
+      close(m_fd);
+      m_fd = -1;
+    }
+  }
+
+ public:
+  /**
+   * Creates (or replaces) path with the state of system, which then lives
+   * there. The file is a snapshot from the first sync() on.
+   */
+  template <typename System>
+  MappedState(std::string const &path, System &system)
+      : m_path(path), m_mode(shared), m_fd(-1), m_memory(nullptr),
+        m_length(header_bytes + system.state_bytes()) {
+    {
+      std::ofstream os(path, std::ios::binary | std::ios::trunc);
+
+      neun::checkpoint::write_header(os);
+      neun::checkpoint::write_size(os, system.state_bytes());
+
+      if (!os) {
+        throw std::runtime_error("mapped state: cannot write " + path);
+      }
+    }
+
+    m_fd = open(path.c_str(), O_RDWR);
+
+    if (m_fd < 0 || ftruncate(m_fd, m_length) != 0) {
+      fail("cannot create");
+    }
+
+    map();
+    system.place_state(m_memory + header_bytes);
+  }
+
+  /* Maps the snapshot in path and makes system, built as the one saved, use it */
+  template <typename System>
+  MappedState(std::string const &path, System &system, mode m)
+      : m_path(path), m_mode(m), m_fd(-1), m_memory(nullptr),
+        m_length(header_bytes + system.state_bytes()) {
+    std::ifstream is(path, std::ios::binary);
+
+    if (!is) {
+      throw std::runtime_error("mapped state: cannot open " + path);
+    }
+
+    neun::checkpoint::read_header(is);
+    neun::checkpoint::expect(is, system.state_bytes(), "size of the mapped state");
+
+    if (std::filesystem::file_size(path) < m_length) {
+      throw std::runtime_error("mapped state: truncated " + path);
+    }
+
+    m_fd = open(path.c_str(), m == shared ? O_RDWR : O_RDONLY);
+
+    if (m_fd < 0) {
+      fail("cannot open");
+    }
+
+    map();
+
+    try {
+      is.seekg(m_length);
+      system.load_events(is);
+    } catch (...) {
+      release();
+      throw;
+    }
+
+    system.adopt_state(m_memory + header_bytes);
+  }
+
+  MappedState(MappedState const &) = delete;
+  MappedState &operator=(MappedState const &) = delete;
+
+  ~MappedState() { release(); }
+
+  /* Makes the file a snapshot of the current state of system */
+  template <typename System>
+  void sync(System const &system) {
+    if (m_mode != shared) {
+      throw std::runtime_error("mapped state: " + m_path + " is mapped copy on write");
+    }
+
+    if (msync(m_memory, m_length, MS_SYNC) != 0) {
+      throw std::runtime_error("mapped state: cannot sync " + m_path);
+    }
+
+    std::ofstream os(m_path, std::ios::binary | std::ios::in | std::ios::out);
+
+    os.seekp(m_length);
+    system.save_events(os);
+
+    const std::streamoff end = os.tellp();
+    os.close();
+
+    if (!os || end < 0) {
+      throw std::runtime_error("mapped state: cannot write " + m_path);
+    }
+
+    std::filesystem::resize_file(m_path, end);
+  }
+
+  std::byte *data() { return m_memory + header_bytes; }
+  std::size_t size() const { return m_length - header_bytes; }
+};
+
+#endif /*MAPPEDSTATE_H_*/
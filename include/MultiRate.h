@@ -0,0 +1,98 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef MULTIRATE_H_
+#define MULTIRATE_H_
+
+#include <iostream>
+
+#include "Checkpoint.h"
+
+/**
+ * @brief Lets a slow component advance once every ratio steps of the fast
+ * components it is coupled to.
+ *
+ * The coupled input (e.g. the presynaptic voltage) is sampled on every fast
+ * step and averaged over the window, so the slow step sees the mean input
+ * rather than only its last value. With ratio 1 every step is a slow step
+ * and the input is passed through unchanged.
+ */
+template <typename Precission>
+class MultiRate
+{
+	int m_ratio;
+	int m_count;
+	Precission m_sum;
+
+public:
+	MultiRate(int ratio = 1) : m_ratio(ratio), m_count(0), m_sum(0) {}
+
+	int ratio() const { return m_ratio; }
+
+	/**
+	 * Accumulates one sample of the input. Returns true when the slow
+	 * component must take its step of size ratio() * h.
+	 */
+	bool sample(Precission input)
+	{
+		m_sum += input;
+
+		return ++m_count >= m_ratio;
+	}
+
+	Precission mean() const { return m_sum / m_count; }
+
+	/* Starts a new window, to be called after the slow step */
+	void restart()
+	{
+		m_count = 0;
+		m_sum = 0;
+	}
+
+	/* The window in progress, see Checkpoint.h */
+	void save(std::ostream &os) const
+	{
+		neun::checkpoint::write_size(os, m_ratio);
+		neun::checkpoint::write(os, m_count);
+		neun::checkpoint::write(os, m_sum);
+	}
+
+	void load(std::istream &is)
+	{
+		neun::checkpoint::expect(is, m_ratio, "slow rate");
+		neun::checkpoint::read(is, m_count);
+		neun::checkpoint::read(is, m_sum);
+	}
+};
+
+#endif /*MULTIRATE_H_*/
@@ -0,0 +1,411 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef NETWORK_H_
+#define NETWORK_H_
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "Checkpoint.h"
+#include "SynapseGroup.h"
+#include "ThreadPool.h"
+
+/**
+ * @brief Populations of neurons connected by groups of synapses.
+ *
+ * Every step, the groups of each kind are stepped one after another, in
+ * the order of Kinds, and then every population. Synapses therefore see
+ * the neurons as they were at the start of the step, as when stepping
+ * each synapsis object before its neurons by hand.
+ *
+ * Given a ThreadPool, a step runs in parallel phases: groups driven by
+ * spikes look for them by ranges of presynaptic neurons and then queue
+ * them (one group per thread), every group steps its synapses by ranges
+ * of presynaptic neurons, then the currents are delivered by ranges of
+ * postsynaptic neurons (each neuron adding the groups that reach it in
+ * the same order as a serial step), and then populations are stepped by
+ * ranges of blocks. No neuron or synapse is
+ * touched by two threads in the same phase, and sums are always taken in
+ * the same order, so results are identical to a serial step whatever the
+ * number of threads. Populations must then also provide blocks() and
+ * step(h, first, last) as NeuronPopulation does.
+ *
+ * @param Population Type of the populations, e.g. NeuronPopulation
+ * @param Integrator Integrator for the state of the synapses
+ * @param Kinds Kinds of synapse the network can hold, see SynapseKinds.h
+ */
+template <typename Population, typename Integrator, typename... Kinds>
+class Network {
+ public:
+  typedef typename Population::precission_t precission_t;
+  typedef typename Population::variable variable;
+
+  template <typename Kind>
+  using group_type = SynapseGroup<Kind, Integrator>;
+
+ private:
+  template <typename Kind>
+  struct projection {
+    int pre;
+    variable pre_variable;
+    int post;
+    variable post_variable;
+    group_type<Kind> group;
+  };
+
+  std::vector<Population> m_populations;
+  std::tuple<std::vector<projection<Kinds>>...> m_projections;
+
+  /* Work items of a parallel step, rebuilt when the network changes */
+  static constexpr int rows_per_task = 256;
+  static constexpr int posts_per_task = 1024;
+  static constexpr int blocks_per_task = 32;
+
+  std::vector<std::function<void()>> m_spike_tasks;
+  std::vector<std::function<void()>> m_queue_tasks;
+  std::vector<std::function<void()>> m_synapse_tasks;
+  std::vector<std::function<void()>> m_delivery_tasks;
+  std::vector<std::function<void()>> m_neuron_tasks;
+  bool m_tasks_valid = false;
+  precission_t m_h = 0;
+
+  template <typename Kind>
+  std::vector<projection<Kind>> &projections() {
+    return std::get<std::vector<projection<Kind>>>(m_projections);
+  }
+
+ public:
+  Network() = default;
+
+  /* Parallel work items point into the network */
+  Network(Network const &) = delete;
+  Network &operator=(Network const &) = delete;
+
+  /**
+   * Returns the index of the new population. Populations with noise are
+   * seeded with that index, so that their neurons draw different noise.
+   */
+  int add_population(int size, typename Population::ConstructorArgs const &args) {
+    m_populations.emplace_back(size, args);
+
+    if constexpr (requires(Population &p) { p.seed(0u); }) {
+      m_populations.back().seed(m_populations.size() - 1);
+    }
+    m_tasks_valid = false;
+
+    return m_populations.size() - 1;
+  }
+
+  int populations() const { return m_populations.size(); }
+
+  Population &population(int index) { return m_populations[index]; }
+  Population const &population(int index) const { return m_populations[index]; }
+
+  /**
+   * Connects population pre to population post (which may be the same)
+   * with synapses of kind Kind, and returns the index of the new group
+   * among those of its kind.
+   *
+   * @param pre_variable Presynaptic variable seen by the synapses
+   * @param post_variable Postsynaptic variable seen by the synapses
+   * @param connections Neuron indices within each population, and weights
+   */
+  template <typename Kind>
+  int connect(int pre, variable pre_variable, int post, variable post_variable,
+              std::vector<typename group_type<Kind>::connection> const &connections,
+              typename Kind::ConstructorArgs const &args) {
+    projections<Kind>().push_back(projection<Kind>{
+        pre, pre_variable, post, post_variable,
+        group_type<Kind>(m_populations[pre].size(), m_populations[post].size(), connections, args)});
+    m_tasks_valid = false;
+
+    return projections<Kind>().size() - 1;
+  }
+
+  template <typename Kind>
+  int groups() const {
+    return std::get<std::vector<projection<Kind>>>(m_projections).size();
+  }
+
+  template <typename Kind>
+  group_type<Kind> &synapses(int index) {
+    return projections<Kind>()[index].group;
+  }
+
+  /**
+   * Saves every population and group, see Checkpoint.h. Loading requires
+   * a network built the same way: same populations and connections, added
+   * in the same order.
+   */
+  void save(std::ostream &os) const {
+    neun::checkpoint::write_size(os, m_populations.size());
+
+    for (Population const &p : m_populations) {
+      p.save(os);
+    }
+
+    std::apply([&](auto const &...kinds) { (save_groups(os, kinds), ...); }, m_projections);
+  }
+
+  void load(std::istream &is) {
+    neun::checkpoint::expect(is, m_populations.size(), "number of populations");
+
+    for (Population &p : m_populations) {
+      p.load(is);
+    }
+
+    std::apply([&](auto &...kinds) { (load_groups(is, kinds), ...); }, m_projections);
+  }
+
+  /**
+   * The state of populations and groups, laid out one after another, can
+   * live in outside memory such as a memory mapped file, see MappedState.h.
+   * Parameters, connectivity, integrator states and spikes in flight (see
+   * save_events) stay in the network. place_state copies the state to memory and adopt_state
+   * takes the one already there, which must come from a network built the
+   * same way. Both return the end of the state in memory.
+   */
+  std::size_t state_bytes() const {
+    std::size_t bytes = 0;
+
+    for (Population const &p : m_populations) {
+      bytes += p.state_bytes();
+    }
+
+    std::apply([&](auto const &...kinds) { ((bytes += group_bytes(kinds)), ...); }, m_projections);
+
+    return bytes;
+  }
+
+  std::byte *place_state(std::byte *memory) {
+    for (Population &p : m_populations) {
+      memory = p.place_state(memory);
+    }
+
+    std::apply([&](auto &...kinds) { ((memory = place_groups(memory, kinds)), ...); }, m_projections);
+
+    return memory;
+  }
+
+  std::byte *adopt_state(std::byte *memory) {
+    for (Population &p : m_populations) {
+      memory = p.adopt_state(memory);
+    }
+
+    std::apply([&](auto &...kinds) { ((memory = adopt_groups(memory, kinds)), ...); }, m_projections);
+
+    return memory;
+  }
+
+  void save_events(std::ostream &os) const {
+    for (Population const &p : m_populations) {
+      p.save_events(os);
+    }
+
+    std::apply([&](auto const &...kinds) { (save_group_events(os, kinds), ...); }, m_projections);
+  }
+
+  void load_events(std::istream &is) {
+    for (Population &p : m_populations) {
+      p.load_events(is);
+    }
+
+    std::apply([&](auto &...kinds) { (load_group_events(is, kinds), ...); }, m_projections);
+  }
+
+  void step(precission_t h) {
+    std::apply([&](auto &...kinds) { (step_groups(kinds, h), ...); }, m_projections);
+
+    for (Population &p : m_populations) {
+      p.step(h);
+    }
+  }
+
+  /* Same as step(h), split among the threads of pool */
+  void step(precission_t h, ThreadPool &pool) {
+    if (!m_tasks_valid) {
+      build_tasks();
+    }
+
+    m_h = h;
+
+    for (auto const *tasks :
+         {&m_spike_tasks, &m_queue_tasks, &m_synapse_tasks, &m_delivery_tasks, &m_neuron_tasks}) {
+      pool.run(tasks->size(), [tasks](int task) { (*tasks)[task](); });
+    }
+  }
+
+ private:
+  template <typename Projections>
+  static void save_groups(std::ostream &os, Projections const &kind) {
+    neun::checkpoint::write_size(os, kind.size());
+
+    for (auto const &p : kind) {
+      neun::checkpoint::write_size(os, p.pre);
+      neun::checkpoint::write_size(os, p.post);
+      p.group.save(os);
+    }
+  }
+
+  template <typename Projections>
+  static void load_groups(std::istream &is, Projections &kind) {
+    neun::checkpoint::expect(is, kind.size(), "number of synapse groups");
+
+    for (auto &p : kind) {
+      neun::checkpoint::expect(is, p.pre, "presynaptic population");
+      neun::checkpoint::expect(is, p.post, "postsynaptic population");
+      p.group.load(is);
+    }
+  }
+
+  template <typename Projections>
+  static std::size_t group_bytes(Projections const &kind) {
+    std::size_t bytes = 0;
+
+    for (auto const &p : kind) {
+      bytes += p.group.state_bytes();
+    }
+
+    return bytes;
+  }
+
+  template <typename Projections>
+  static std::byte *place_groups(std::byte *memory, Projections &kind) {
+    for (auto &p : kind) {
+      memory = p.group.place_state(memory);
+    }
+
+    return memory;
+  }
+
+  template <typename Projections>
+  static std::byte *adopt_groups(std::byte *memory, Projections &kind) {
+    for (auto &p : kind) {
+      memory = p.group.adopt_state(memory);
+    }
+
+    return memory;
+  }
+
+  template <typename Projections>
+  static void save_group_events(std::ostream &os, Projections const &kind) {
+    for (auto const &p : kind) {
+      p.group.save_events(os);
+    }
+  }
+
+  template <typename Projections>
+  static void load_group_events(std::istream &is, Projections &kind) {
+    for (auto &p : kind) {
+      p.group.load_events(is);
+    }
+  }
+
+  void build_tasks() {
+    m_spike_tasks.clear();
+    m_queue_tasks.clear();
+    m_synapse_tasks.clear();
+    m_delivery_tasks.clear();
+    m_neuron_tasks.clear();
+
+    std::apply([&](auto &...kinds) { (add_synapse_tasks(kinds), ...); }, m_projections);
+
+    for (int post = 0; post < (int)m_populations.size(); ++post) {
+      for (int first = 0; first < m_populations[post].size(); first += posts_per_task) {
+        const int last = std::min(first + posts_per_task, m_populations[post].size());
+
+        m_delivery_tasks.push_back([this, post, first, last] {
+          std::apply([&](auto &...kinds) { (deliver(kinds, post, first, last), ...); }, m_projections);
+        });
+      }
+    }
+
+    for (Population &p : m_populations) {
+      for (int first = 0; first < p.blocks(); first += blocks_per_task) {
+        const int last = std::min(first + blocks_per_task, p.blocks());
+
+        m_neuron_tasks.push_back([this, &p, first, last] { p.step(m_h, first, last); });
+      }
+    }
+
+    m_tasks_valid = true;
+  }
+
+  template <typename Projections>
+  void add_synapse_tasks(Projections &kind) {
+    for (auto &p : kind) {
+      for (int first = 0; first < p.group.pre_size(); first += rows_per_task) {
+        const int last = std::min(first + rows_per_task, p.group.pre_size());
+
+        if constexpr (std::remove_reference_t<decltype(p.group)>::spiking) {
+          m_spike_tasks.push_back([this, &p, first, last] {
+            p.group.detect_spikes(m_populations[p.pre], p.pre_variable, first, last);
+          });
+        }
+
+        m_synapse_tasks.push_back([this, &p, first, last] {
+          p.group.step_synapses(m_h, m_populations[p.pre], p.pre_variable, m_populations[p.post],
+                                p.post_variable, first, last);
+        });
+      }
+
+      if constexpr (std::remove_reference_t<decltype(p.group)>::spiking) {
+        m_queue_tasks.push_back([&p] { p.group.queue_spikes(); });
+      }
+    }
+  }
+
+  template <typename Projections>
+  void deliver(Projections &kind, int post, int first, int last) {
+    for (auto &p : kind) {
+      if (p.post == post) {
+        p.group.deliver(m_populations[post], first, last);
+      }
+    }
+  }
+
+  template <typename Projections>
+  void step_groups(Projections &kind, precission_t h) {
+    for (auto &p : kind) {
+      p.group.step(h, m_populations[p.pre], p.pre_variable, m_populations[p.post],
+                   p.post_variable);
+    }
+  }
+};
+
+#endif /*NETWORK_H_*/
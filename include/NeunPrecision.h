@@ -0,0 +1,239 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef NEUNPRECISION_H_
+#define NEUNPRECISION_H_
+
+#include "IntegratorState.h"
+#include "StatefulIntegratorConcept.h"
+
+/**
+ * \brief Precision policies for DifferentialNeuronWrapper.
+ *
+ * A policy decides how the increment computed by the integrator is added
+ * to the variables of the system. Policies provide
+ * \li template <typename System> state_type, with void reset(), called
+ * whenever the variables are set from outside
+ * \li template <typename Integrator, typename System> static void
+ * step(System &, h, variables, parameters, integrator state, policy state)
+ *
+ * native lets the integrator update the variables in place, as always.
+ * The other two are meant for float systems: the integrator runs on the
+ * increment of the step, which starts at zero and so keeps every bit of
+ * precision, and the increment is then accumulated into a wider or
+ * compensated sum. Without them, increments far smaller than the
+ * variables (typical of small steps) lose most of their bits in every
+ * addition and the error grows with the number of steps.
+ *
+ * Only stateless integrators are supported by the accumulating policies:
+ * error control and derivative histories would see the increment rather
+ * than the variables.
+ */
+namespace neun::precision
+{
+
+namespace detail
+{
+
+/* The system as seen from the start of the step: variables are offsets from base */
+template <typename System>
+class increment_system
+{
+	System &m_system;
+	typename System::precission_t const *m_base;
+
+public:
+	typedef typename System::precission_t precission_t;
+	typedef typename System::variable variable;
+	typedef typename System::parameter parameter;
+
+	static constexpr int n_variables = System::n_variables;
+	static constexpr int n_parameters = System::n_parameters;
+
+	increment_system(System &system, precission_t const *base) : m_system(system), m_base(base) {}
+
+	void eval(precission_t const * const offsets, precission_t * const params, precission_t * const incs) const
+	{
+		precission_t vars[n_variables];
+
+		for (int i = 0; i < n_variables; ++i) {
+			vars[i] = m_base[i] + offsets[i];
+		}
+
+		m_system.eval(vars, params, incs);
+	}
+
+	precission_t get(variable var) const { return m_system.get(var); }
+	precission_t get(parameter param) const { return m_system.get(param); }
+	void set(variable var, precission_t value) { m_system.set(var, value); }
+	void set(parameter param, precission_t value) { m_system.set(param, value); }
+};
+
+/* Runs Integrator on the increment of one step, left in delta */
+template <typename Integrator, typename System>
+void increment(System &s,
+	typename System::precission_t h,
+	typename System::precission_t const * const variables,
+	typename System::precission_t * const parameters,
+	typename System::precission_t * const delta)
+{
+	static_assert(!StatefulIntegratorConcept<Integrator, increment_system<System>>,
+		"Accumulating precision policies need a stateless integrator");
+
+	increment_system<System> inc(s, variables);
+
+	for (int i = 0; i < System::n_variables; ++i) {
+		delta[i] = 0;
+	}
+
+	Integrator::template step<increment_system<System>>(inc, h, delta, parameters);
+}
+
+} // namespace detail
+
+/**
+ * The integrator updates the variables in place.
+ */
+struct native
+{
+	template <typename System>
+	struct state_type
+	{
+		void reset() {}
+	};
+
+	template <typename Integrator, typename System>
+	static void step(System &s,
+		typename System::precission_t h,
+		typename System::precission_t * const variables,
+		typename System::precission_t * const parameters,
+		typename IntegratorState<Integrator, System>::type &integrator_state,
+		state_type<System> &)
+	{
+		integrator_step<Integrator, System>(s, h, variables, parameters, integrator_state);
+	}
+};
+
+/**
+ * Variables are accumulated in Accumulator (double for float systems);
+ * the system sees them rounded to its precission_t.
+ */
+template <typename Accumulator = double>
+struct accumulate
+{
+	template <typename System>
+	struct state_type
+	{
+		Accumulator sum[System::n_variables];
+		bool loaded = false;
+
+		void reset() { loaded = false; }
+	};
+
+	template <typename Integrator, typename System>
+	static void step(System &s,
+		typename System::precission_t h,
+		typename System::precission_t * const variables,
+		typename System::precission_t * const parameters,
+		typename IntegratorState<Integrator, System>::type &,
+		state_type<System> &state)
+	{
+		typedef typename System::precission_t precission_t;
+
+		precission_t delta[System::n_variables];
+
+		if (!state.loaded) {
+			for (int i = 0; i < System::n_variables; ++i) {
+				state.sum[i] = variables[i];
+			}
+
+			state.loaded = true;
+		}
+
+		detail::increment<Integrator>(s, h, variables, parameters, delta);
+
+		for (int i = 0; i < System::n_variables; ++i) {
+			state.sum[i] += delta[i];
+			variables[i] = precission_t(state.sum[i]);
+		}
+	}
+};
+
+/**
+ * Increments are added with Kahan compensated summation, keeping the
+ * rounding error of every addition to feed it back into the next one.
+ * Must not be compiled with -ffast-math, which folds the compensation
+ * away.
+ */
+struct kahan
+{
+	template <typename System>
+	struct state_type
+	{
+		typename System::precission_t compensation[System::n_variables] = {};
+
+		void reset()
+		{
+			for (auto &c : compensation) {
+				c = 0;
+			}
+		}
+	};
+
+	template <typename Integrator, typename System>
+	static void step(System &s,
+		typename System::precission_t h,
+		typename System::precission_t * const variables,
+		typename System::precission_t * const parameters,
+		typename IntegratorState<Integrator, System>::type &,
+		state_type<System> &state)
+	{
+		typedef typename System::precission_t precission_t;
+
+		precission_t delta[System::n_variables];
+
+		detail::increment<Integrator>(s, h, variables, parameters, delta);
+
+		for (int i = 0; i < System::n_variables; ++i) {
+			const precission_t y = delta[i] - state.compensation[i];
+			const precission_t t = variables[i] + y;
+
+			state.compensation[i] = (t - variables[i]) - y;
+			variables[i] = t;
+		}
+	}
+};
+
+} // namespace neun::precision
+
+#endif /*NEUNPRECISION_H_*/
@@ -0,0 +1,360 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef NEURONPOPULATION_H_
+#define NEURONPOPULATION_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+#include "Checkpoint.h"
+#include "IntegratorState.h"
+#include "ModelConcept.h"
+#include "StateArray.h"
+
+/**
+ * \brief Many neurons of the same model sharing one set of parameters.
+ *
+ * Neurons are stored in blocks of Lanes. Inside a block each variable is a
+ * contiguous array of Lanes values, so integrators providing step_batch
+ * (the explicit Runge-Kutta family, Euler included) advance a whole block
+ * at once with vectorised stage combinations. Each lane keeps a Model
+ * object, which only holds its synaptic input (and whatever the model
+ * derives from the parameters), so a neuron costs n_variables + 1 values
+ * instead of a full wrapper with its own parameter copy.
+ *
+ * Integrators without step_batch are called one lane at a time on the
+ * bare model, which works for those that do not require a full system
+ * (e.g. Stepper for maps). Stateful ones get a state per neuron, kept
+ * apart from the variables; noise streams (see NoiseStream) are keyed by
+ * the index of the neuron, so the noise does not depend on the threads.
+ *
+ * A model's post_step(h) works on the variables of a wrapper, which lanes
+ * do not have. Models with discrete updates after the step (e.g. the spike
+ * reset of IzhikevichModel) provide post_step(h, variables, parameters),
+ * which is called on every lane; when it changes the variables, the
+ * integrator state of the lane restarts.
+ *
+ * Parameters are shared, so models writing outputs into them (see
+ * OutputParametersConcept) are rejected.
+ *
+ * \param Model The neuron model
+ * \param Integrator The integrator class to use
+ * \param Lanes Neurons per block
+ */
+template <typename Model, typename Integrator, int Lanes = 8>
+requires ModelConcept<Model>
+class NeuronPopulation
+{
+  static_assert(!OutputParametersConcept<Model>,
+                "Models writing outputs into their parameters cannot share them");
+
+ public:
+  typedef typename Model::precission_t precission_t;
+  typedef typename Model::variable variable;
+  typedef typename Model::parameter parameter;
+
+  static constexpr int n_variables = Model::n_variables;
+  static constexpr int n_parameters = Model::n_parameters;
+  static constexpr int lanes = Lanes;
+
+  struct ConstructorArgs {
+    precission_t params[Model::n_parameters];
+  };
+
+ private:
+  struct block {
+    Model models[Lanes];
+    precission_t variables[Model::n_variables][Lanes];
+  };
+
+  typedef typename IntegratorState<Integrator, Model>::type integrator_state_type;
+
+  static constexpr bool stateful = !std::is_empty_v<integrator_state_type>;
+  static constexpr bool noisy = requires(integrator_state_type &state) { state.key(0u, 0u); };
+  static constexpr bool resetting =
+      requires(Model model, precission_t h, precission_t *values) { model.post_step(h, values, values); };
+
+  StateArray<block> m_blocks;
+  int m_size;
+
+  /* One per lane, padding included; none for stateless integrators */
+  std::vector<integrator_state_type> m_states;
+
+  precission_t m_parameters[Model::n_parameters];
+
+  block &block_of(int i) { return m_blocks[i / Lanes]; }
+  block const &block_of(int i) const { return m_blocks[i / Lanes]; }
+
+  void restart_integrators() {
+    for (integrator_state_type &state : m_states) {
+      state.reset();
+    }
+  }
+
+  void parameters_changed() {
+    if constexpr (ParameterHookConcept<Model>) {
+      for (block &b : m_blocks) {
+        for (int l = 0; l < Lanes; ++l) {
+          b.models[l].on_parameters_changed(m_parameters);
+        }
+      }
+    }
+  }
+
+ public:
+  /**
+   * @param size Number of neurons. Variables start at 0, padding lanes of
+   * the last block are integrated but never visible.
+   */
+  NeuronPopulation(int size, ConstructorArgs const &args)
+      : m_blocks((size + Lanes - 1) / Lanes), m_size(size) {
+    std::copy(args.params, args.params + Model::n_parameters, m_parameters);
+
+    if constexpr (stateful) {
+      m_states.resize(m_blocks.size() * Lanes);
+    }
+
+    if constexpr (noisy) {
+      seed(0);
+    }
+
+    for (block &b : m_blocks) {
+      for (int i = 0; i < Model::n_variables; ++i) {
+        std::fill(b.variables[i], b.variables[i] + Lanes, precission_t(0));
+      }
+    }
+
+    parameters_changed();
+  }
+
+  int size() const { return m_size; }
+
+  precission_t get(int neuron, variable var) const {
+    return block_of(neuron).variables[var][neuron % Lanes];
+  }
+
+  /* Changing the state from outside invalidates what the integrator kept */
+  void set(int neuron, variable var, precission_t value) {
+    block_of(neuron).variables[var][neuron % Lanes] = value;
+
+    if constexpr (stateful) {
+      m_states[neuron].reset();
+    }
+  }
+
+  /* Sets var in every neuron, padding lanes included */
+  void set(variable var, precission_t value) {
+    for (block &b : m_blocks) {
+      std::fill(b.variables[var], b.variables[var] + Lanes, value);
+    }
+
+    restart_integrators();
+  }
+
+  precission_t get(parameter param) const { return m_parameters[param]; }
+
+  void set(parameter param, precission_t value) {
+    m_parameters[param] = value;
+    parameters_changed();
+    restart_integrators();
+  }
+
+  void add_synaptic_input(int neuron, precission_t i) {
+    block_of(neuron).models[neuron % Lanes].add_synaptic_input(i);
+  }
+
+  precission_t get_synaptic_input(int neuron) const {
+    return block_of(neuron).models[neuron % Lanes].get_synaptic_input();
+  }
+
+  int blocks() const { return m_blocks.size(); }
+
+  integrator_state_type &integrator_state(int neuron) requires stateful { return m_states[neuron]; }
+
+  /* Keys the noise of neuron i as (i, seed), restarting it */
+  void seed(std::uint32_t seed) requires noisy {
+    for (std::size_t i = 0; i < m_states.size(); ++i) {
+      m_states[i].key(i, seed);
+    }
+  }
+
+  /**
+   * Saves parameters, variables and synaptic inputs, see Checkpoint.h.
+   * Loading requires a population of the same type and size.
+   */
+  void save(std::ostream &os) const {
+    neun::checkpoint::write_shape<precission_t>(os, n_variables, n_parameters);
+    neun::checkpoint::write_size(os, Lanes);
+    neun::checkpoint::write_size(os, m_size);
+    neun::checkpoint::write(os, m_parameters, n_parameters);
+
+    for (block const &b : m_blocks) {
+      neun::checkpoint::write(os, &b.variables[0][0], n_variables * Lanes);
+
+      for (int l = 0; l < Lanes; ++l) {
+        neun::checkpoint::write(os, b.models[l].get_synaptic_input());
+      }
+    }
+
+    save_events(os);
+  }
+
+  void load(std::istream &is) {
+    neun::checkpoint::expect_shape<precission_t>(is, n_variables, n_parameters);
+    neun::checkpoint::expect(is, Lanes, "lanes");
+    neun::checkpoint::expect(is, m_size, "population size");
+    neun::checkpoint::read(is, m_parameters, n_parameters);
+
+    for (block &b : m_blocks) {
+      neun::checkpoint::read(is, &b.variables[0][0], n_variables * Lanes);
+
+      for (int l = 0; l < Lanes; ++l) {
+        precission_t input;
+        neun::checkpoint::read(is, input);
+        b.models[l].reset_synaptic_input();
+        b.models[l].add_synaptic_input(input);
+      }
+    }
+
+    parameters_changed();
+    load_events(is);
+  }
+
+  /**
+   * Variables and synaptic inputs can live in outside memory, e.g. a
+   * memory mapped file (see MappedState.h), while parameters stay here.
+   * place_state copies them to memory, adopt_state takes those already
+   * there; both return the end of the state in memory.
+   */
+  std::size_t state_bytes() const { return m_blocks.bytes(); }
+
+  std::byte *place_state(std::byte *memory) { return m_blocks.place(memory); }
+
+  /* What models derive from the parameters is computed again for these */
+  std::byte *adopt_state(std::byte *memory) {
+    memory = m_blocks.adopt(memory);
+    parameters_changed();
+
+    return memory;
+  }
+
+  /**
+   * Integrator states are not part of the state in memory and are saved
+   * with the events, see Network::save_events. Those that cannot be saved
+   * (see neun::checkpoint::write_state) restart on load.
+   */
+  void save_events(std::ostream &os) const {
+    for (integrator_state_type const &state : m_states) {
+      neun::checkpoint::write_state(os, state);
+    }
+  }
+
+  void load_events(std::istream &is) {
+    for (integrator_state_type &state : m_states) {
+      neun::checkpoint::read_state(is, state);
+    }
+  }
+
+  void step(precission_t h) { step(h, 0, blocks()); }
+
+  /* Steps blocks [first, last), i.e. neurons [first * Lanes, last * Lanes) */
+  void step(precission_t h, int first, int last) {
+    precission_t *parameters[Lanes];
+    std::fill(parameters, parameters + Lanes, static_cast<precission_t *>(m_parameters));
+
+    for (int n = first; n < last; ++n) {
+      block &b = m_blocks[n];
+
+      if constexpr (requires { Integrator::step_batch(b.models, h, b.variables, parameters); }) {
+        Integrator::step_batch(b.models, h, b.variables, parameters);
+      } else {
+        for (int l = 0; l < Lanes; ++l) {
+          precission_t lane[Model::n_variables];
+
+          for (int i = 0; i < Model::n_variables; ++i) {
+            lane[i] = b.variables[i][l];
+          }
+
+          if constexpr (stateful) {
+            integrator_step<Integrator, Model>(b.models[l], h, lane, m_parameters, m_states[n * Lanes + l]);
+          } else {
+            Integrator::step(b.models[l], h, lane, m_parameters);
+          }
+
+          for (int i = 0; i < Model::n_variables; ++i) {
+            b.variables[i][l] = lane[i];
+          }
+        }
+      }
+
+      if constexpr (resetting) {
+        post_step(h, n);
+      }
+
+      for (int l = 0; l < Lanes; ++l) {
+        b.models[l].reset_synaptic_input();
+      }
+    }
+  }
+
+ private:
+  void post_step(precission_t h, int n) {
+    block &b = m_blocks[n];
+
+    for (int l = 0; l < Lanes; ++l) {
+      precission_t lane[Model::n_variables], before[Model::n_variables];
+
+      for (int i = 0; i < Model::n_variables; ++i) {
+        lane[i] = before[i] = b.variables[i][l];
+      }
+
+      b.models[l].post_step(h, lane, m_parameters);
+
+      if (!std::equal(lane, lane + Model::n_variables, before)) {
+        for (int i = 0; i < Model::n_variables; ++i) {
+          b.variables[i][l] = lane[i];
+        }
+
+        if constexpr (stateful) {
+          m_states[n * Lanes + l].reset();
+        }
+      }
+    }
+  }
+};
+
+#endif /*NEURONPOPULATION_H_*/
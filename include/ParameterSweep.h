@@ -0,0 +1,247 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef PARAMETERSWEEP_H_
+#define PARAMETERSWEEP_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "IntegratorState.h"
+#include "ModelConcept.h"
+#include "SpikeStatistics.h"
+#include "ThreadPool.h"
+
+/**
+ * \brief Runs a model once per set of parameters, in parallel, and
+ * reports statistics of the spikes of each run.
+ *
+ * Runs start from a base set of parameters. vary() turns every run into
+ * one per value of a parameter, so successive calls build a grid, and
+ * add() appends single runs. Runs are batched in blocks of Lanes, laid out
+ * as in NeuronPopulation but with a parameter set per lane, so integrators
+ * providing step_batch advance a whole block at once. Blocks are spread
+ * among the threads of a ThreadPool, and the summary of each run is
+ * handed over as soon as its block is done, so results arrive in no
+ * particular order (runs are identified by index). Stateful integrators
+ * get a state per run, and noise streams (see NoiseStream) are keyed by
+ * the index of the run, so results do not depend on the threads.
+ *
+ * \param Model The neuron model
+ * \param Integrator The integrator class to use
+ * \param Lanes Runs per block
+ */
+template <typename Model, typename Integrator, int Lanes = 8>
+requires ModelConcept<Model>
+class ParameterSweep
+{
+ public:
+  typedef typename Model::precission_t precission_t;
+  typedef typename Model::variable variable;
+  typedef typename Model::parameter parameter;
+
+  struct ConstructorArgs {
+    precission_t params[Model::n_parameters];
+  };
+
+  typedef typename SpikeStatistics<precission_t>::summary summary;
+
+  /* How every run is simulated and measured */
+  struct settings {
+    precission_t h;
+    /* Simulated time, of which the first transient is not measured */
+    precission_t duration;
+    precission_t transient;
+    /* Variable whose spikes are measured */
+    variable measured;
+    precission_t threshold;
+    /* Spikes further apart than this belong to different bursts */
+    precission_t burst_gap;
+    /* Constant synaptic input */
+    precission_t input;
+    /* Seed of the noise, for stochastic integrators */
+    std::uint32_t seed = 0;
+  };
+
+ private:
+  struct block {
+    Model models[Lanes];
+    precission_t variables[Model::n_variables][Lanes];
+  };
+
+  typedef typename IntegratorState<Integrator, Model>::type integrator_state_type;
+
+  std::vector<ConstructorArgs> m_runs;
+  precission_t m_initial[Model::n_variables];
+
+ public:
+  ParameterSweep(ConstructorArgs const &base) : m_runs(1, base) {
+    std::fill(m_initial, m_initial + Model::n_variables, precission_t(0));
+  }
+
+  /* Replaces every run by one per value of param */
+  void vary(parameter param, std::vector<precission_t> const &values) {
+    std::vector<ConstructorArgs> runs;
+    runs.reserve(m_runs.size() * values.size());
+
+    for (ConstructorArgs const &run : m_runs) {
+      for (precission_t value : values) {
+        runs.push_back(run);
+        runs.back().params[param] = value;
+      }
+    }
+
+    m_runs = std::move(runs);
+  }
+
+  /* Appends a run with parameters args */
+  void add(ConstructorArgs const &args) { m_runs.push_back(args); }
+
+  int size() const { return m_runs.size(); }
+
+  ConstructorArgs const &run(int index) const { return m_runs[index]; }
+
+  /* Initial value of var in every run, 0 by default */
+  void set(variable var, precission_t value) { m_initial[var] = value; }
+
+  /**
+   * Runs the sweep, calling result(index, summary) for each run. Calls
+   * are never concurrent.
+   */
+  void run(settings const &s, ThreadPool &pool,
+           std::function<void(int, summary const &)> const &result) const {
+    const int blocks = (size() + Lanes - 1) / Lanes;
+    std::mutex mutex;
+
+    pool.run(blocks, [&](int b) {
+      const int first = b * Lanes;
+      const int last = std::min(first + Lanes, size());
+
+      summary summaries[Lanes];
+      run_block(s, first, last, summaries);
+
+      std::lock_guard<std::mutex> lock(mutex);
+
+      for (int r = first; r < last; ++r) {
+        result(r, summaries[r - first]);
+      }
+    });
+  }
+
+  /* Runs the sweep and returns the summaries in the order of the runs */
+  std::vector<summary> run(settings const &s, ThreadPool &pool) const {
+    std::vector<summary> summaries(size());
+
+    run(s, pool, [&](int index, summary const &result) { summaries[index] = result; });
+
+    return summaries;
+  }
+
+ private:
+  /* Padding lanes repeat the last run and are not reported */
+  void run_block(settings const &s, int first, int last, summary (&summaries)[Lanes]) const {
+    block b;
+    precission_t parameters[Lanes][Model::n_parameters];
+    precission_t *lane_parameters[Lanes];
+    integrator_state_type states[Lanes];
+
+    for (int l = 0; l < Lanes; ++l) {
+      const int r = std::min(first + l, last - 1);
+      ConstructorArgs const &args = m_runs[r];
+
+      if constexpr (requires { states[l].key(0u, 0u); }) {
+        states[l].key(r, s.seed);
+      }
+
+      std::copy(args.params, args.params + Model::n_parameters, parameters[l]);
+      lane_parameters[l] = parameters[l];
+
+      if constexpr (ParameterHookConcept<Model>) {
+        b.models[l].on_parameters_changed(parameters[l]);
+      }
+
+      for (int i = 0; i < Model::n_variables; ++i) {
+        b.variables[i][l] = m_initial[i];
+      }
+    }
+
+    std::vector<SpikeStatistics<precission_t>> statistics(Lanes, {s.threshold, s.burst_gap});
+
+    const long steps = s.duration / s.h;
+    const long transient = s.transient / s.h;
+
+    for (long n = 0; n < steps; ++n) {
+      for (int l = 0; l < Lanes; ++l) {
+        b.models[l].add_synaptic_input(s.input);
+      }
+
+      if constexpr (requires { Integrator::step_batch(b.models, s.h, b.variables, lane_parameters); }) {
+        Integrator::step_batch(b.models, s.h, b.variables, lane_parameters);
+      } else {
+        for (int l = 0; l < Lanes; ++l) {
+          precission_t lane[Model::n_variables];
+
+          for (int i = 0; i < Model::n_variables; ++i) {
+            lane[i] = b.variables[i][l];
+          }
+
+          integrator_step<Integrator, Model>(b.models[l], s.h, lane, parameters[l], states[l]);
+
+          for (int i = 0; i < Model::n_variables; ++i) {
+            b.variables[i][l] = lane[i];
+          }
+        }
+      }
+
+      for (int l = 0; l < Lanes; ++l) {
+        b.models[l].reset_synaptic_input();
+      }
+
+      if (n + 1 >= transient) {
+        for (int l = 0; l < Lanes; ++l) {
+          statistics[l].sample((n + 1) * s.h, b.variables[s.measured][l]);
+        }
+      }
+    }
+
+    for (int l = 0; l < last - first; ++l) {
+      summaries[l] = statistics[l].get();
+    }
+  }
+};
+
+#endif /*PARAMETERSWEEP_H_*/
@@ -0,0 +1,85 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef PHILOX_H_
+#define PHILOX_H_
+
+#include <cstdint>
+
+/**
+ * @brief Philox4x32-10 counter-based random number generator (Salmon et
+ * al., 2011).
+ *
+ * Maps a 128 bit counter and a 64 bit key to 128 random bits. There is no
+ * hidden state: the same (counter, key) always gives the same numbers, so
+ * streams keyed by system and indexed by step are reproducible no matter
+ * how systems are distributed among threads.
+ */
+class Philox
+{
+public:
+	struct block
+	{
+		std::uint32_t v[4];
+	};
+
+	static block generate(block counter, std::uint32_t key0, std::uint32_t key1)
+	{
+		for (int round = 0; round < 10; ++round) {
+			const std::uint64_t p0 = std::uint64_t(0xD2511F53) * counter.v[0];
+			const std::uint64_t p1 = std::uint64_t(0xCD9E8D57) * counter.v[2];
+
+			counter = block{{
+				std::uint32_t(p1 >> 32) ^ counter.v[1] ^ key0,
+				std::uint32_t(p1),
+				std::uint32_t(p0 >> 32) ^ counter.v[3] ^ key1,
+				std::uint32_t(p0)
+			}};
+
+			key0 += 0x9E3779B9;
+			key1 += 0xBB67AE85;
+		}
+
+		return counter;
+	}
+
+	/* Uniform double in (0, 1) from 64 random bits */
+	static double to_uniform(std::uint32_t hi, std::uint32_t lo)
+	{
+		const std::uint64_t bits = (std::uint64_t(hi) << 32 | lo) >> 11;
+
+		return (bits + 0.5) / 9007199254740992.0;
+	}
+};
+
+#endif /*PHILOX_H_*/
@@ -0,0 +1,163 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef RATETABLE_H_
+#define RATETABLE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief Rates functions of the voltage sampled on a uniform grid.
+ *
+ * All the rates of a node are stored together with their slope to the next
+ * node, so a lookup is one index computation and Rates multiply-adds on a
+ * single cache line.
+ *
+ * The error of the linear interpolation is measured at construction at the
+ * midpoints of the grid, where it is largest, and reported by max_error.
+ *
+ * @param Rates Number of functions sampled
+ */
+template <typename Precission, int Rates>
+class RateTable
+{
+	struct node
+	{
+		Precission value[Rates];
+		Precission slope[Rates];
+	};
+
+	Precission m_v_min;
+	Precission m_v_max;
+	Precission m_dv;
+	Precission m_inv_dv;
+
+	std::vector<node> m_nodes;
+
+	Precission m_max_error;
+
+public:
+	/**
+	 * @param rates Callable as rates(v, out) filling out[0 .. Rates - 1].
+	 * Removable singularities that produce NaN at a node are sampled as the
+	 * mean of both sides.
+	 */
+	template <typename F>
+	RateTable(Precission v_min, Precission v_max, Precission dv, F rates)
+		: m_v_min(v_min), m_dv(dv), m_inv_dv(1 / dv), m_max_error(0)
+	{
+		const int points = (int)std::ceil((v_max - v_min) / dv) + 1;
+		m_v_max = v_min + (points - 1) * dv;
+
+		std::vector<node> samples(points);
+
+		for (int i = 0; i < points; ++i) {
+			sample(rates, v_min + i * dv, samples[i].value);
+		}
+
+		for (int i = 0; i + 1 < points; ++i) {
+			for (int r = 0; r < Rates; ++r) {
+				samples[i].slope[r] = samples[i + 1].value[r] - samples[i].value[r];
+			}
+		}
+
+		for (int r = 0; r < Rates; ++r) {
+			samples[points - 1].slope[r] = 0;
+		}
+
+		m_nodes.swap(samples);
+
+		Precission exact[Rates], interpolated[Rates];
+
+		for (int i = 0; i + 1 < points; ++i) {
+			const Precission v = v_min + (i + Precission(0.5)) * dv;
+
+			sample(rates, v, exact);
+			lookup(v, interpolated);
+
+			for (int r = 0; r < Rates; ++r) {
+				m_max_error = std::max(m_max_error, std::abs(exact[r] - interpolated[r]));
+			}
+		}
+	}
+
+	bool contains(Precission v) const { return v >= m_v_min && v < m_v_max; }
+
+	/* v must be within the grid, see contains */
+	void lookup(Precission v, Precission * const out) const
+	{
+		const Precission x = (v - m_v_min) * m_inv_dv;
+		const int i = (int)x;
+		const Precission t = x - i;
+
+		node const &n = m_nodes[i];
+
+		for (int r = 0; r < Rates; ++r) {
+			out[r] = n.value[r] + t * n.slope[r];
+		}
+	}
+
+	/* Largest absolute interpolation error over all rates */
+	Precission max_error() const { return m_max_error; }
+
+	Precission v_min() const { return m_v_min; }
+	Precission v_max() const { return m_v_max; }
+	Precission dv() const { return m_dv; }
+
+private:
+	template <typename F>
+	void sample(F &rates, Precission v, Precission * const out) const
+	{
+		rates(v, out);
+
+		if (std::all_of(out, out + Rates, [](Precission x) { return std::isfinite(x); })) {
+			return;
+		}
+
+		Precission below[Rates], above[Rates];
+		const Precission eps = m_dv * Precission(1e-3);
+
+		rates(v - eps, below);
+		rates(v + eps, above);
+
+		for (int r = 0; r < Rates; ++r) {
+			if (!std::isfinite(out[r])) {
+				out[r] = (below[r] + above[r]) / 2;
+			}
+		}
+	}
+};
+
+#endif /*RATETABLE_H_*/
@@ -0,0 +1,592 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef RECORDER_H_
+#define RECORDER_H_
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Records variables and parameters of systems into a binary file
+ * from a background thread.
+ *
+ * Channels are added with add() or add_envelope() (any object with
+ * get(variable) or get(parameter), e.g. a wrapper), and sample() is
+ * called once per step; each call is a tick, at time tick * dt.
+ *
+ * Each channel keeps one value every decimation ticks (those with tick
+ * % decimation == 0) or, as an envelope, the minimum and maximum of each
+ * run of decimation ticks. Ticks can also be gated: only those inside one
+ * of the windows given to record_between and, if there is a trigger,
+ * within [spike - before, spike + after] of an upward threshold crossing
+ * of the trigger are recorded. To record before a crossing, values are
+ * held back for before and written once it is known whether a crossing
+ * follows.
+ *
+ * Recorded ticks are stored in chunks of consecutive ticks, one column
+ * per channel (two for envelopes). Envelope runs are only cut where the
+ * gate closes. Chunks are collected in a buffer that
+ * is handed to a writer thread when full, while sampling goes on in the
+ * other buffer.
+ *
+ * File layout, in the byte order of the machine:
+ * \li "NEUNREC" and a zero byte, uint32 version (2)
+ * \li uint32 columns, uint32 bytes per value (4 or 8), float64 dt
+ * \li per column, uint32 length and the name, uint32 mode (0 value, 1
+ * minimum, 2 maximum) and uint32 decimation
+ * \li chunks of uint64 first tick, uint32 ticks, and per column uint32
+ * rows followed by the values
+ *
+ * A value column has a row for every tick of the chunk multiple of its
+ * decimation; envelopes have a row for every run of decimation ticks the
+ * chunk touches, taken at the first tick of the run within the chunk.
+ * read() loads a file back with the time of every row.
+ *
+ * A failed write is kept by the writer thread and thrown as a
+ * std::runtime_error by the next hand-over of a buffer (within sample())
+ * or by close(). The destructor closes the file but cannot report it, so
+ * call close() to know that the whole trace was written.
+ */
+template <typename Precission = double>
+class Recorder {
+  static_assert(std::is_floating_point<Precission>::value);
+
+ public:
+  static constexpr std::uint32_t version = 2;
+
+  enum mode { value, minimum, maximum };
+
+  struct trace {
+    double dt;
+    std::vector<std::string> names;
+    std::vector<std::vector<Precission>> columns;
+    std::vector<std::vector<double>> times;
+  };
+
+ private:
+  struct channel {
+    void const *object;
+    int index;
+    Precission (*get)(void const *, int);
+  };
+
+  struct column {
+    int channel;
+    mode kind;
+    long decimation;
+    std::vector<Precission> rows;
+
+    /* Run of ticks being reduced by an envelope */
+    long window = -1;
+    Precission extreme = 0;
+  };
+
+  template <typename System, typename Enum>
+  static Precission get_value(void const *object, int index) {
+    return static_cast<System const *>(object)->get(static_cast<Enum>(index));
+  }
+
+  std::string m_path;
+  std::ofstream m_file;
+
+  std::vector<channel> m_channels;
+  std::vector<std::string> m_names;
+  std::vector<column> m_columns;
+
+  const double m_dt;
+  const int m_decimation;
+  const long m_capacity;
+
+  bool m_started = false;
+  long m_tick = 0;
+  std::vector<Precission> m_values;
+
+  /* Gate */
+  std::vector<std::pair<double, double>> m_windows;
+
+  bool m_triggered = false;
+  channel m_trigger;
+  Precission m_threshold = 0;
+  Precission m_last_trigger = std::numeric_limits<Precission>::quiet_NaN();
+  long m_before = 0;
+  long m_after = 0;
+  long m_last_crossing = std::numeric_limits<long>::min() / 2;
+
+  /* Values of the last m_before + 1 ticks, waiting for the gate */
+  std::vector<Precission> m_delay;
+
+  /* Chunk being recorded */
+  long m_chunk_first = 0;
+  long m_chunk_ticks = 0;
+
+  /* Buffers of serialised chunks, one filling and one being written */
+  std::vector<char> m_buffers[2];
+  int m_active = 0;
+
+  std::thread m_writer;
+  std::mutex m_mutex;
+  std::condition_variable m_changed;
+  bool m_pending = false;
+  bool m_stop = false;
+  /* Set by the writer when the file fails */
+  bool m_failed = false;
+
+  template <typename T>
+  void write(T value) {
+    m_file.write(reinterpret_cast<char const *>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  void append(T const *data, size_t n) {
+    std::vector<char> &buffer = m_buffers[m_active];
+    char const *bytes = reinterpret_cast<char const *>(data);
+
+    buffer.insert(buffer.end(), bytes, bytes + n * sizeof(T));
+  }
+
+  void start() {
+    write_header();
+
+    m_values.resize(m_channels.size());
+    m_delay.resize((m_before + 1) * m_channels.size());
+
+    m_writer = std::thread(&Recorder::writer, this);
+    m_started = true;
+  }
+
+  void write_header() {
+    m_file.write("NEUNREC", 8);
+    write(version);
+    write(std::uint32_t(m_columns.size()));
+    write(std::uint32_t(sizeof(Precission)));
+    write(m_dt);
+
+    for (size_t c = 0; c < m_columns.size(); ++c) {
+      write(std::uint32_t(m_names[c].size()));
+      m_file.write(m_names[c].data(), m_names[c].size());
+      write(std::uint32_t(m_columns[c].kind));
+      write(std::uint32_t(m_columns[c].decimation));
+    }
+  }
+
+  void writer() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (;;) {
+      m_changed.wait(lock, [&] { return m_pending || m_stop; });
+
+      if (!m_pending) {
+        return;
+      }
+
+      std::vector<char> &buffer = m_buffers[m_active ^ 1];
+
+      lock.unlock();
+
+      m_file.write(buffer.data(), buffer.size());
+      buffer.clear();
+
+      const bool failed = !m_file;
+
+      lock.lock();
+      m_failed = m_failed || failed;
+      m_pending = false;
+      m_changed.notify_all();
+    }
+  }
+
+  /* Hands the active buffer to the writer and continues in the other one */
+  void flush() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_changed.wait(lock, [&] { return !m_pending; });
+
+    if (m_failed) {
+      throw std::runtime_error("Recorder: cannot write " + m_path);
+    }
+
+    m_pending = true;
+    m_active ^= 1;
+
+    m_changed.notify_all();
+  }
+
+  /* Lets the writer finish the pending buffer and closes the file */
+  void stop() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+
+    m_changed.notify_all();
+    m_writer.join();
+    m_file.close();
+    m_started = false;
+  }
+
+  bool open(long tick) const {
+    if (!m_windows.empty()) {
+      const double time = tick * m_dt;
+
+      if (std::none_of(m_windows.begin(), m_windows.end(),
+                       [&](auto const &w) { return w.first <= time && time < w.second; })) {
+        return false;
+      }
+    }
+
+    // Crossings up to tick + m_before are known, so the latest one decides
+    return !m_triggered || m_last_crossing >= tick - m_after;
+  }
+
+  void record(long tick, Precission const *values) {
+    if (!open(tick)) {
+      end_chunk();
+      return;
+    }
+
+    if (m_chunk_ticks == 0) {
+      m_chunk_first = tick;
+    }
+
+    for (column &c : m_columns) {
+      const Precission v = values[c.channel];
+
+      if (c.kind == value) {
+        if (tick % c.decimation == 0) {
+          c.rows.push_back(v);
+        }
+      } else {
+        const long window = tick / c.decimation;
+
+        if (window != c.window) {
+          if (c.window >= 0) {
+            c.rows.push_back(c.extreme);
+          }
+
+          c.window = window;
+          c.extreme = v;
+        } else {
+          c.extreme = (c.kind == minimum) ? std::min(c.extreme, v) : std::max(c.extreme, v);
+        }
+      }
+    }
+
+    // Full chunks end where no envelope run is cut
+    if (++m_chunk_ticks >= m_capacity &&
+        std::all_of(m_columns.begin(), m_columns.end(), [&](column const &c) {
+          return c.kind == value || (tick + 1) % c.decimation == 0;
+        })) {
+      end_chunk();
+    }
+  }
+
+  void end_chunk() {
+    if (m_chunk_ticks == 0) {
+      return;
+    }
+
+    const std::uint64_t first = m_chunk_first;
+    append(&first, 1);
+
+    const std::uint32_t ticks = m_chunk_ticks;
+    append(&ticks, 1);
+
+    for (column &c : m_columns) {
+      if (c.window >= 0) {
+        c.rows.push_back(c.extreme);
+        c.window = -1;
+      }
+
+      const std::uint32_t rows = c.rows.size();
+      append(&rows, 1);
+      append(c.rows.data(), c.rows.size());
+      c.rows.clear();
+    }
+
+    m_chunk_ticks = 0;
+
+    if (m_buffers[m_active].size() >= m_capacity * m_columns.size() * sizeof(Precission)) {
+      flush();
+    }
+  }
+
+  template <typename System, typename Enum>
+  channel make_channel(System const &system, Enum e) {
+    if (m_started) {
+      throw std::logic_error("Recorder: channels must be added before sampling");
+    }
+
+    return channel{&system, e, &get_value<System, Enum>};
+  }
+
+  void add_column(channel const &ch, std::string const &name, mode kind, int decimation) {
+    const int index = std::find_if(m_channels.begin(), m_channels.end(), [&](channel const &c) {
+      return c.object == ch.object && c.index == ch.index && c.get == ch.get;
+    }) - m_channels.begin();
+
+    if (index == (int)m_channels.size()) {
+      m_channels.push_back(ch);
+    }
+
+    column c;
+    c.channel = index;
+    c.kind = kind;
+    c.decimation = decimation > 0 ? decimation : m_decimation;
+
+    m_columns.push_back(c);
+    m_names.push_back(name);
+  }
+
+ public:
+  /**
+   * @param path File to write
+   * @param dt Time between calls to sample
+   * @param decimation Default decimation of the channels
+   * @param capacity Ticks per chunk, and roughly the size of each buffer
+   */
+  Recorder(std::string const &path, double dt, int decimation = 1, int capacity = 1 << 14)
+      : m_path(path), m_file(path, std::ios::binary), m_dt(dt), m_decimation(decimation), m_capacity(capacity) {
+    if (!m_file) {
+      throw std::runtime_error("Recorder: cannot open " + path);
+    }
+  }
+
+  Recorder(Recorder const &) = delete;
+  Recorder &operator=(Recorder const &) = delete;
+
+  ~Recorder() {
+    try {
+      close();
+    } catch (std::runtime_error const &) {
+    }
+  }
+
+  /**
+   * Records var (a variable or parameter of system) every decimation
+   * ticks, the recorder's decimation by default. Channels, windows and
+   * triggers must be set before the first sample.
+   */
+  template <typename System, typename Enum>
+  requires std::same_as<Enum, typename System::variable> || std::same_as<Enum, typename System::parameter>
+  void add(System const &system, Enum var, std::string const &name, int decimation = 0) {
+    add_column(make_channel(system, var), name, value, decimation);
+  }
+
+  /* Records the minimum and maximum of var over every run of decimation ticks, as name.min and name.max */
+  template <typename System, typename Enum>
+  requires std::same_as<Enum, typename System::variable> || std::same_as<Enum, typename System::parameter>
+  void add_envelope(System const &system, Enum var, std::string const &name, int decimation) {
+    add_column(make_channel(system, var), name + ".min", minimum, decimation);
+    add_column(make_channel(system, var), name + ".max", maximum, decimation);
+  }
+
+  /* Records ticks with time in [t0, t1); may be called more than once */
+  void record_between(double t0, double t1) {
+    if (m_started) {
+      throw std::logic_error("Recorder: windows must be set before sampling");
+    }
+
+    m_windows.emplace_back(t0, t1);
+  }
+
+  /* Records from before to after around every upward crossing of threshold by var */
+  template <typename System, typename Enum>
+  requires std::same_as<Enum, typename System::variable> || std::same_as<Enum, typename System::parameter>
+  void trigger(System const &system, Enum var, Precission threshold, double before, double after) {
+    m_trigger = make_channel(system, var);
+    m_threshold = threshold;
+    m_before = std::lround(before / m_dt);
+    m_after = std::lround(after / m_dt);
+    m_triggered = true;
+  }
+
+  int columns() const { return m_columns.size(); }
+
+  void sample() {
+    if (!m_started) {
+      start();
+    }
+
+    const long tick = m_tick++;
+    const int n = m_channels.size();
+
+    if (m_triggered) {
+      const Precission v = m_trigger.get(m_trigger.object, m_trigger.index);
+
+      if (m_last_trigger < m_threshold && v >= m_threshold) {
+        m_last_crossing = tick;
+      }
+
+      m_last_trigger = v;
+    }
+
+    Precission *values = m_delay.data() + (tick % (m_before + 1)) * n;
+
+    for (int c = 0; c < n; ++c) {
+      values[c] = m_channels[c].get(m_channels[c].object, m_channels[c].index);
+    }
+
+    if (tick >= m_before) {
+      record(tick - m_before, m_delay.data() + ((tick + 1) % (m_before + 1)) * n);
+    }
+  }
+
+  /**
+   * Writes what is left and waits for the writer. Throws if any write
+   * failed. Called on destruction
+   */
+  void close() {
+    if (!m_started) {
+      if (m_file.is_open()) {
+        write_header();
+        m_file.close();
+
+        if (!m_file) {
+          throw std::runtime_error("Recorder: cannot write " + m_path);
+        }
+      }
+
+      return;
+    }
+
+    const int n = m_channels.size();
+
+    try {
+      for (long tick = std::max(0L, m_tick - m_before); tick < m_tick; ++tick) {
+        record(tick, m_delay.data() + (tick % (m_before + 1)) * n);
+      }
+
+      end_chunk();
+
+      if (!m_buffers[m_active].empty()) {
+        flush();
+      }
+    } catch (...) {
+      stop();
+      throw;
+    }
+
+    stop();
+
+    if (m_failed || !m_file) {
+      throw std::runtime_error("Recorder: cannot write " + m_path);
+    }
+  }
+
+  /* Loads a whole file written by a Recorder of the same Precission */
+  static trace read(std::string const &path) {
+    std::ifstream file(path, std::ios::binary);
+
+    auto read_value = [&](auto &value) {
+      file.read(reinterpret_cast<char *>(&value), sizeof(value));
+    };
+
+    char magic[8];
+    std::uint32_t file_version, columns, bytes;
+    trace t;
+
+    file.read(magic, 8);
+    read_value(file_version);
+
+    if (!file || std::string(magic) != "NEUNREC" || file_version != version) {
+      throw std::runtime_error("Recorder: " + path + " is not a trace");
+    }
+
+    read_value(columns);
+    read_value(bytes);
+    read_value(t.dt);
+
+    if (bytes != sizeof(Precission)) {
+      throw std::runtime_error("Recorder: " + path + " has another precission");
+    }
+
+    std::vector<std::uint32_t> kinds(columns), decimations(columns);
+
+    t.names.resize(columns);
+    t.columns.resize(columns);
+    t.times.resize(columns);
+
+    for (std::uint32_t c = 0; c < columns; ++c) {
+      std::uint32_t length;
+      read_value(length);
+      t.names[c].resize(length);
+      file.read(t.names[c].data(), length);
+      read_value(kinds[c]);
+      read_value(decimations[c]);
+    }
+
+    for (std::uint64_t first; read_value(first), file;) {
+      std::uint32_t ticks;
+      read_value(ticks);
+
+      const std::uint64_t end = first + ticks;
+
+      for (std::uint32_t c = 0; c < columns; ++c) {
+        std::vector<Precission> &column = t.columns[c];
+        const std::uint64_t k = decimations[c];
+        std::uint32_t rows;
+
+        read_value(rows);
+
+        const size_t size = column.size();
+        column.resize(size + rows);
+        file.read(reinterpret_cast<char *>(column.data() + size), rows * sizeof(Precission));
+
+        if (kinds[c] == value) {
+          for (std::uint64_t tick = (first + k - 1) / k * k; tick < end; tick += k) {
+            t.times[c].push_back(tick * t.dt);
+          }
+        } else {
+          for (std::uint64_t tick = first; tick < end; tick = (tick / k + 1) * k) {
+            t.times[c].push_back(tick * t.dt);
+          }
+        }
+      }
+    }
+
+    return t;
+  }
+};
+
+#endif /*RECORDER_H_*/
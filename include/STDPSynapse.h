@@ -97,6 +97,12 @@ class STDPSynapse : public SerializableWrapper<
           m_last_spike_post = -999;
         }
  private:
+  // Spike time interpolated between the previous and the current sample, so
+  // that plasticity does not depend on the spike being quantised to h
+  precission crossing_time(precission old_value, precission value, precission threshold, precission h) const {
+    return m_current_time - h + h * (threshold - old_value) / (value - old_value);
+  }
+
   void calculate_i() {
     precission E_syn = System::m_parameters[System::E_syn];
   
@@ -115,7 +121,7 @@ class STDPSynapse : public SerializableWrapper<
      
     // For vpre
     if (System::m_parameters[System::v_pre] >= threshold && m_vpre_old < threshold) {
-      m_last_spike_pre = m_current_time;
+      m_last_spike_pre = crossing_time(m_vpre_old, System::m_parameters[System::v_pre], threshold, h);
       System::m_variables[System::s] = 1.0; // Update s if vpre spikes
       
       // △t = t_pre - t_post
@@ -130,7 +136,7 @@ class STDPSynapse : public SerializableWrapper<
 
     // For vpost
     if (System::m_parameters[System::v_post] >= threshold && m_vpost_old < threshold) {
-      m_last_spike_post = m_current_time;
+      m_last_spike_post = crossing_time(m_vpost_old, System::m_parameters[System::v_post], threshold, h);
       
       // △t = t_pre - t_post
       precission delta_t = m_last_spike_pre - m_last_spike_post; 
@@ -196,6 +202,25 @@ class STDPSynapse : public SerializableWrapper<
     System::m_variables[System::g] = g;
   }
 
+  /* Also saves the clock and the last spikes, see Checkpoint.h */
+  void save(std::ostream &os) const {
+    System::save(os);
+    neun::checkpoint::write(os, m_vpre_old);
+    neun::checkpoint::write(os, m_vpost_old);
+    neun::checkpoint::write(os, m_current_time);
+    neun::checkpoint::write(os, m_last_spike_pre);
+    neun::checkpoint::write(os, m_last_spike_post);
+  }
+
+  void load(std::istream &is) {
+    System::load(is);
+    neun::checkpoint::read(is, m_vpre_old);
+    neun::checkpoint::read(is, m_vpost_old);
+    neun::checkpoint::read(is, m_current_time);
+    neun::checkpoint::read(is, m_last_spike_pre);
+    neun::checkpoint::read(is, m_last_spike_post);
+  }
+
 };
 
 #endif /*STDPSYNAPSE_H_*/
@@ -0,0 +1,119 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef SPIKEQUEUE_H_
+#define SPIKEQUEUE_H_
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Checkpoint.h"
+
+/**
+ * @brief Events waiting for their arrival step, in a ring buffer.
+ *
+ * Slot k holds the events arriving k steps from now. An event is any
+ * integer, e.g. the index of the synapse a spike travels through. Each
+ * step, arriving() is consumed and then advance() moves to the next step.
+ */
+class SpikeQueue {
+  std::vector<std::vector<int>> m_slots;
+  int m_now;
+
+ public:
+  /* @param max_delay Largest delay, in steps, of any event */
+  explicit SpikeQueue(int max_delay = 0) : m_slots(max_delay + 1), m_now(0) {}
+
+  int max_delay() const { return m_slots.size() - 1; }
+
+  /* Queues event to arrive delay steps from now; 0 arrives this step */
+  void push(int event, int delay) {
+    if (delay < 0 || delay > max_delay()) {
+      throw std::out_of_range("spike queue: delay " + std::to_string(delay) + " outside [0, " +
+                              std::to_string(max_delay()) + "]");
+    }
+
+    int slot = m_now + delay;
+
+    if (slot >= (int)m_slots.size()) {
+      slot -= m_slots.size();
+    }
+
+    m_slots[slot].push_back(event);
+  }
+
+  std::vector<int> const &arriving() const { return m_slots[m_now]; }
+
+  void advance() {
+    m_slots[m_now].clear();
+    m_now = (m_now + 1 == (int)m_slots.size()) ? 0 : m_now + 1;
+  }
+
+  void clear() {
+    for (std::vector<int> &slot : m_slots) {
+      slot.clear();
+    }
+  }
+
+  /* Events in flight, see Checkpoint.h */
+  void save(std::ostream &os) const {
+    neun::checkpoint::write_size(os, m_slots.size());
+    neun::checkpoint::write(os, m_now);
+
+    for (std::vector<int> const &slot : m_slots) {
+      neun::checkpoint::write_vector(os, slot);
+    }
+  }
+
+  void load(std::istream &is) {
+    neun::checkpoint::expect(is, m_slots.size(), "spike queue length");
+
+    int now;
+    neun::checkpoint::read(is, now);
+
+    if (now < 0 || now >= (int)m_slots.size()) {
+      throw std::runtime_error("checkpoint: spike queue position is " + std::to_string(now) + ", expected below " +
+                               std::to_string(m_slots.size()));
+    }
+
+    m_now = now;
+
+    for (std::vector<int> &slot : m_slots) {
+      neun::checkpoint::read_vector(is, slot);
+    }
+  }
+};
+
+#endif /*SPIKEQUEUE_H_*/
@@ -0,0 +1,143 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef SPIKESTATISTICS_H_
+#define SPIKESTATISTICS_H_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/**
+ * @brief Statistics of the spikes of a variable, accumulated one sample at
+ * a time so that runs need not keep their traces.
+ *
+ * A spike is an upward crossing of the threshold, timed by linear
+ * interpolation between the two samples around it. Spikes closer than
+ * burst_gap belong to the same burst.
+ */
+template <typename Precission>
+class SpikeStatistics {
+ public:
+  struct summary {
+    int spikes;
+    /* Mean and standard deviation of the interval between spikes */
+    Precission period;
+    Precission period_sd;
+    int bursts;
+    Precission spikes_per_burst;
+    /* Mean time from the first to the last spike of a burst */
+    Precission burst_duration;
+    /* Mean time between the first spikes of consecutive bursts */
+    Precission burst_period;
+  };
+
+ private:
+  Precission m_threshold;
+  Precission m_burst_gap;
+
+  Precission m_last_time;
+  Precission m_last_value;
+
+  int m_spikes = 0;
+  Precission m_last_spike = 0;
+  Precission m_interval_sum = 0;
+  Precission m_interval_squares = 0;
+
+  int m_bursts = 0;
+  Precission m_first_burst = 0;
+  Precission m_burst_start = 0;
+  Precission m_duration_sum = 0;
+
+  void spike(Precission time) {
+    if (m_spikes > 0) {
+      const Precission interval = time - m_last_spike;
+
+      m_interval_sum += interval;
+      m_interval_squares += interval * interval;
+
+      if (interval > m_burst_gap) {
+        m_duration_sum += m_last_spike - m_burst_start;
+        m_burst_start = time;
+        ++m_bursts;
+      }
+    } else {
+      m_first_burst = m_burst_start = time;
+      m_bursts = 1;
+    }
+
+    m_last_spike = time;
+    ++m_spikes;
+  }
+
+  static constexpr Precission nan = std::numeric_limits<Precission>::quiet_NaN();
+
+ public:
+  SpikeStatistics(Precission threshold, Precission burst_gap)
+      : m_threshold(threshold), m_burst_gap(burst_gap), m_last_time(0), m_last_value(nan) {}
+
+  /* Adds the value of the variable at time, later than the previous sample */
+  void sample(Precission time, Precission value) {
+    if (m_last_value < m_threshold && value >= m_threshold) {
+      spike(m_last_time + (time - m_last_time) * (m_threshold - m_last_value) / (value - m_last_value));
+    }
+
+    m_last_time = time;
+    m_last_value = value;
+  }
+
+  /* Values with too few spikes or bursts to be defined are NaN */
+  summary get() const {
+    summary s{m_spikes, nan, nan, m_bursts, nan, nan, nan};
+
+    if (m_spikes > 1) {
+      const int intervals = m_spikes - 1;
+
+      s.period = m_interval_sum / intervals;
+      s.period_sd = std::sqrt(std::max(Precission(0), m_interval_squares / intervals - s.period * s.period));
+    }
+
+    if (m_bursts > 0) {
+      s.spikes_per_burst = Precission(m_spikes) / m_bursts;
+      s.burst_duration = (m_duration_sum + m_last_spike - m_burst_start) / m_bursts;
+    }
+
+    if (m_bursts > 1) {
+      s.burst_period = (m_burst_start - m_first_burst) / (m_bursts - 1);
+    }
+
+    return s;
+  }
+};
+
+#endif /*SPIKESTATISTICS_H_*/
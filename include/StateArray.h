@@ -0,0 +1,139 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef STATEARRAY_H_
+#define STATEARRAY_H_
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Array of state that can be moved out of the object holding it,
+ * e.g. into a memory mapped file (see MappedState.h).
+ *
+ * It owns its elements until place() copies them to some memory, or
+ * adopt() starts using the elements already there. From then on the
+ * memory must outlive the array, which never frees it. Copies of the array
+ * own their elements again.
+ *
+ * Elements must be trivially copyable to be placed or adopted, as their
+ * bytes are what is stored.
+ */
+template <typename T>
+class StateArray {
+  static_assert(alignof(T) <= 64);
+
+  std::vector<T> m_owned;
+  T *m_data;
+  std::size_t m_size;
+
+ public:
+  /* Arrays placed one after another are aligned to this */
+  static constexpr std::size_t alignment = 64;
+
+  explicit StateArray(std::size_t size = 0, T const &value = T())
+      : m_owned(size, value), m_data(m_owned.data()), m_size(size) {}
+
+  StateArray(StateArray const &other)
+      : m_owned(other.begin(), other.end()), m_data(m_owned.data()), m_size(other.m_size) {}
+
+  StateArray(StateArray &&other) : m_data(other.m_data), m_size(other.m_size) {
+    if (other.owned()) {
+      m_owned.swap(other.m_owned);
+      m_data = m_owned.data();
+    }
+
+    other.m_data = other.m_owned.data();
+    other.m_size = 0;
+  }
+
+  StateArray &operator=(StateArray other) {
+    const bool other_owned = other.owned();
+
+    m_owned.swap(other.m_owned);
+    m_data = other_owned ? m_owned.data() : other.m_data;
+    m_size = other.m_size;
+
+    return *this;
+  }
+
+  std::size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+  T *data() { return m_data; }
+  T const *data() const { return m_data; }
+
+  T &operator[](std::size_t i) { return m_data[i]; }
+  T const &operator[](std::size_t i) const { return m_data[i]; }
+
+  T *begin() { return m_data; }
+  T *end() { return m_data + m_size; }
+  T const *begin() const { return m_data; }
+  T const *end() const { return m_data + m_size; }
+
+  /* Whether the elements live in memory given by place() or adopt() */
+  bool owned() const { return m_data == m_owned.data(); }
+
+  /* Bytes taken in memory, padding to the next array included */
+  std::size_t bytes() const {
+    return (m_size * sizeof(T) + alignment - 1) / alignment * alignment;
+  }
+
+  /**
+   * Copies the elements to memory (aligned to alignment) and uses them
+   * there. Returns where the next array goes.
+   */
+  std::byte *place(std::byte *memory) {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    std::memcpy(memory, m_data, m_size * sizeof(T));
+    m_owned = std::vector<T>();
+    m_data = reinterpret_cast<T *>(memory);
+
+    return memory + bytes();
+  }
+
+  /* Uses the elements already in memory, as left there by place() */
+  std::byte *adopt(std::byte *memory) {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    m_owned = std::vector<T>();
+    m_data = reinterpret_cast<T *>(memory);
+
+    return memory + bytes();
+  }
+};
+
+#endif /*STATEARRAY_H_*/
@@ -0,0 +1,407 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef SYNAPSEGROUP_H_
+#define SYNAPSEGROUP_H_
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "Checkpoint.h"
+#include "SpikeQueue.h"
+#include "StateArray.h"
+
+/**
+ * @brief Synapses of the same kind from one population to another,
+ * stored in compressed sparse row form.
+ *
+ * Synapses are sorted by presynaptic neuron (keeping the order in which
+ * they were given for each one), with their postsynaptic neuron, weight,
+ * state and last current in parallel arrays. Stepping the group walks
+ * them in that order, reading the presynaptic voltage once per neuron,
+ * and then delivers the currents: each postsynaptic neuron gets the sum
+ * of its synapses in that same order, through a transposed index.
+ *
+ * Both phases work on ranges (of presynaptic neurons, and of
+ * postsynaptic neurons) that touch disjoint data, so they can be split
+ * among threads (see Network::step with a ThreadPool) and the result does
+ * not depend on how they are split.
+ *
+ * Kinds driven by presynaptic spikes (those with on_spike, see
+ * SynapseKinds.h) do not read the presynaptic voltage on every synapse.
+ * Instead exchange_spikes, run before stepping the synapses, checks each
+ * presynaptic neuron once for an upward crossing of the kind's threshold
+ * and queues an event for each of its synapses, to arrive after the delay
+ * of the synapse (in steps). Arriving events call on_spike on their
+ * synapse. The check can also be split by ranges of presynaptic neurons
+ * (detect_spikes), followed by queue_spikes, which queues the spikes in
+ * presynaptic order so that events do not depend on the split either.
+ *
+ * Populations must provide get(int, variable), add_synaptic_input(int,
+ * precission_t) and size(), as NeuronPopulation does.
+ *
+ * @param Kind Kind of synapse, see SynapseKinds.h
+ * @param Integrator Integrator for the state of the synapses
+ */
+template <typename Kind, typename Integrator>
+class SynapseGroup {
+ public:
+  typedef typename Kind::precission_t precission_t;
+  typedef typename Kind::parameter parameter;
+  typedef typename Kind::ConstructorArgs ConstructorArgs;
+
+  typedef std::array<precission_t, Kind::n_variables> state_type;
+
+  static constexpr bool spiking = requires(Kind kind, precission_t *state) { kind.on_spike(state); };
+
+  struct connection {
+    int pre;
+    int post;
+    precission_t weight;
+    int delay = 0;
+  };
+
+ private:
+  Kind m_kind;
+
+  std::vector<int> m_row;
+  std::vector<int> m_post;
+  StateArray<precission_t> m_weight;
+  StateArray<state_type> m_state;
+  StateArray<precission_t> m_current;
+  std::vector<int> m_delay;
+
+  /* Spikes on their way, and presynaptic values of the last step */
+  SpikeQueue m_queue;
+  StateArray<precission_t> m_last_pre;
+
+  /* Presynaptic neurons that crossed the threshold, until queue_spikes */
+  std::vector<char> m_fired;
+
+  /* Synapses of each postsynaptic neuron, in increasing order */
+  std::vector<int> m_column;
+  std::vector<int> m_incoming;
+
+ public:
+  /**
+   * @param pre_size Neurons in the presynaptic population
+   * @param post_size Neurons in the postsynaptic population
+   * @param connections The synapses, in any order
+   * @param args Parameters shared by every synapse
+   */
+  SynapseGroup(int pre_size, int post_size, std::vector<connection> const &connections,
+               ConstructorArgs const &args)
+      : m_kind(args),
+        m_row(pre_size + 1, 0),
+        m_post(connections.size()),
+        m_weight(connections.size()),
+        m_state(connections.size()),
+        m_current(connections.size(), 0),
+        m_delay(connections.size()),
+        m_column(post_size + 1, 0),
+        m_incoming(connections.size()) {
+    for (connection const &c : connections) {
+      ++m_row[c.pre + 1];
+    }
+
+    for (int i = 0; i < pre_size; ++i) {
+      m_row[i + 1] += m_row[i];
+    }
+
+    std::vector<int> next(m_row.begin(), m_row.end() - 1);
+
+    for (connection const &c : connections) {
+      const int s = next[c.pre]++;
+
+      m_post[s] = c.post;
+      m_weight[s] = c.weight;
+      m_delay[s] = c.delay;
+      m_kind.initialise(m_state[s].data());
+    }
+
+    if constexpr (spiking) {
+      m_queue = SpikeQueue(m_delay.empty() ? 0 : *std::max_element(m_delay.begin(), m_delay.end()));
+      m_last_pre = StateArray<precission_t>(pre_size, std::numeric_limits<precission_t>::quiet_NaN());
+      m_fired.assign(pre_size, 0);
+    }
+
+    for (int j : m_post) {
+      ++m_column[j + 1];
+    }
+
+    for (int j = 0; j < post_size; ++j) {
+      m_column[j + 1] += m_column[j];
+    }
+
+    std::vector<int> next_incoming(m_column.begin(), m_column.end() - 1);
+
+    for (int s = 0; s < size(); ++s) {
+      m_incoming[next_incoming[m_post[s]]++] = s;
+    }
+  }
+
+  int size() const { return m_post.size(); }
+
+  int pre_size() const { return m_row.size() - 1; }
+  int post_size() const { return m_column.size() - 1; }
+
+  /* Synapses of presynaptic neuron pre are [begin(pre), end(pre)) */
+  int begin(int pre) const { return m_row[pre]; }
+  int end(int pre) const { return m_row[pre + 1]; }
+
+  int post(int synapse) const { return m_post[synapse]; }
+
+  precission_t weight(int synapse) const { return m_weight[synapse]; }
+
+  void set_weight(int synapse, precission_t value) { m_weight[synapse] = value; }
+
+  int delay(int synapse) const { return m_delay[synapse]; }
+
+  state_type &state(int synapse) { return m_state[synapse]; }
+  state_type const &state(int synapse) const { return m_state[synapse]; }
+
+  /* Current delivered by the synapse on the last step */
+  precission_t current(int synapse) const { return m_current[synapse]; }
+
+  precission_t get(parameter param) const { return m_kind.get(param); }
+
+  void set(parameter param, precission_t value) { m_kind.set(param, value); }
+
+  /**
+   * Saves parameters, weights, the state and current of every synapse and
+   * the spikes in flight, see Checkpoint.h. Loading requires a group with
+   * the same connections and delays, only weights are taken from the file.
+   */
+  void save(std::ostream &os) const {
+    neun::checkpoint::write_shape<precission_t>(os, Kind::n_variables, Kind::n_parameters);
+
+    for (int i = 0; i < Kind::n_parameters; ++i) {
+      neun::checkpoint::write(os, m_kind.get(static_cast<parameter>(i)));
+    }
+
+    neun::checkpoint::write_vector(os, m_row);
+    neun::checkpoint::write_vector(os, m_post);
+    neun::checkpoint::write_vector(os, m_delay);
+    neun::checkpoint::write_vector(os, m_weight);
+    neun::checkpoint::write_vector(os, m_state);
+    neun::checkpoint::write_vector(os, m_current);
+
+    if constexpr (spiking) {
+      neun::checkpoint::write_vector(os, m_last_pre);
+    }
+
+    save_events(os);
+  }
+
+  void load(std::istream &is) {
+    neun::checkpoint::expect_shape<precission_t>(is, Kind::n_variables, Kind::n_parameters);
+
+    for (int i = 0; i < Kind::n_parameters; ++i) {
+      precission_t value;
+      neun::checkpoint::read(is, value);
+      m_kind.set(static_cast<parameter>(i), value);
+    }
+
+    for (std::vector<int> const *structure : {&m_row, &m_post, &m_delay}) {
+      std::vector<int> stored;
+      neun::checkpoint::read_vector(is, stored);
+
+      if (stored != *structure) {
+        throw std::runtime_error("checkpoint: synapse group connected differently");
+      }
+    }
+
+    neun::checkpoint::expect(is, size(), "number of synapses");
+    neun::checkpoint::read(is, m_weight.data(), size());
+    neun::checkpoint::expect(is, size(), "number of synapses");
+    neun::checkpoint::read(is, m_state.data(), size());
+    neun::checkpoint::expect(is, size(), "number of synapses");
+    neun::checkpoint::read(is, m_current.data(), size());
+
+    if constexpr (spiking) {
+      neun::checkpoint::expect(is, pre_size(), "presynaptic neurons");
+      neun::checkpoint::read(is, m_last_pre.data(), pre_size());
+    }
+
+    load_events(is);
+  }
+
+  /* Spikes in flight, saved on their own when the rest of the state is placed */
+  void save_events(std::ostream &os) const {
+    if constexpr (spiking) {
+      m_queue.save(os);
+    }
+  }
+
+  void load_events(std::istream &is) {
+    if constexpr (spiking) {
+      m_queue.load(is);
+    }
+  }
+
+  /**
+   * Weights, the state and current of every synapse and the last
+   * presynaptic values can live in outside memory, as in NeuronPopulation.
+   * Connectivity, parameters and spikes in flight stay here.
+   */
+  std::size_t state_bytes() const {
+    return m_weight.bytes() + m_state.bytes() + m_current.bytes() + m_last_pre.bytes();
+  }
+
+  std::byte *place_state(std::byte *memory) {
+    memory = m_weight.place(memory);
+    memory = m_state.place(memory);
+    memory = m_current.place(memory);
+
+    return m_last_pre.place(memory);
+  }
+
+  std::byte *adopt_state(std::byte *memory) {
+    memory = m_weight.adopt(memory);
+    memory = m_state.adopt(memory);
+    memory = m_current.adopt(memory);
+
+    return m_last_pre.adopt(memory);
+  }
+
+  template <typename Pre, typename Post>
+  void step(precission_t h, Pre const &pre, typename Pre::variable pre_variable,
+            Post &post, typename Post::variable post_variable) {
+    exchange_spikes(pre, pre_variable);
+    step_synapses(h, pre, pre_variable, post, post_variable, 0, pre_size());
+    deliver(post, 0, post_size());
+  }
+
+  /**
+   * Queues the spikes of the presynaptic population and hands the events
+   * arriving this step to their synapses. Does nothing for kinds not
+   * driven by spikes.
+   */
+  template <typename Pre>
+  void exchange_spikes(Pre const &pre, typename Pre::variable pre_variable) {
+    detect_spikes(pre, pre_variable, 0, pre_size());
+    queue_spikes();
+  }
+
+  /**
+   * Marks the presynaptic neurons [first, last) that crossed the threshold
+   * this step, for queue_spikes. Ranges touch disjoint data.
+   */
+  template <typename Pre>
+  void detect_spikes(Pre const &pre, typename Pre::variable pre_variable, int first, int last) {
+    if constexpr (spiking) {
+      const precission_t threshold = m_kind.threshold();
+
+      for (int i = first; i < last; ++i) {
+        const precission_t v_pre = pre.get(i, pre_variable);
+
+        m_fired[i] = m_last_pre[i] < threshold && v_pre >= threshold;
+        m_last_pre[i] = v_pre;
+      }
+    }
+  }
+
+  /* Queues the marked spikes and hands the events arriving this step to their synapses */
+  void queue_spikes() {
+    if constexpr (spiking) {
+      for (int i = 0; i < pre_size(); ++i) {
+        if (m_fired[i]) {
+          for (int s = m_row[i]; s < m_row[i + 1]; ++s) {
+            m_queue.push(s, m_delay[s]);
+          }
+
+          m_fired[i] = 0;
+        }
+      }
+
+      for (int s : m_queue.arriving()) {
+        m_kind.on_spike(m_state[s].data());
+      }
+
+      m_queue.advance();
+    }
+  }
+
+  /**
+   * Steps the synapses of presynaptic neurons [first, last) and computes
+   * their currents, without delivering them.
+   */
+  template <typename Pre, typename Post>
+  void step_synapses(precission_t h, Pre const &pre, typename Pre::variable pre_variable,
+                     Post const &post, typename Post::variable post_variable,
+                     int first, int last) {
+    // presynaptic() keeps per neuron values in the kind, so every range has its own
+    Kind kind = m_kind;
+
+    for (int i = first; i < last; ++i) {
+      if (m_row[i] == m_row[i + 1]) {
+        continue;
+      }
+
+      precission_t v_pre = 0;
+
+      if constexpr (!spiking) {
+        v_pre = pre.get(i, pre_variable);
+        kind.presynaptic(v_pre);
+      }
+
+
+      for (int s = m_row[i]; s < m_row[i + 1]; ++s) {
+        precission_t *state = m_state[s].data();
+
+        kind.template step<Integrator>(h, state, v_pre);
+        m_current[s] = kind.current(state, m_weight[s], v_pre, post.get(m_post[s], post_variable));
+      }
+    }
+  }
+
+  /* Adds the currents of the last step to postsynaptic neurons [first, last) */
+  template <typename Post>
+  void deliver(Post &post, int first, int last) const {
+    for (int j = first; j < last; ++j) {
+      precission_t input = 0;
+
+      for (int k = m_column[j]; k < m_column[j + 1]; ++k) {
+        input += m_current[m_incoming[k]];
+      }
+
+      post.add_synaptic_input(j, input);
+    }
+  }
+};
+
+#endif /*SYNAPSEGROUP_H_*/
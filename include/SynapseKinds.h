@@ -0,0 +1,316 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef SYNAPSEKINDS_H_
+#define SYNAPSEKINDS_H_
+
+#include <algorithm>
+#include <cmath>
+
+#include "ChemicalSynapsisModel.h"
+#include "DiffusionSynapsisModel.h"
+#include "GradualActivationSynapsisModel.h"
+#include "IntegratorConcept.h"
+#include "NeunMath.h"
+#include "SystemWrapper.h"
+
+/*
+ * Kinds of synapse for SynapseGroup. A kind holds the parameters shared by
+ * every synapse of a group and knows how to advance the state of one
+ * synapse and compute its current. It must provide
+ *
+ * \li precission_t, parameter, n_parameters, ConstructorArgs
+ * \li static constexpr int n_variables, the state kept per synapse
+ * \li void initialise(precission_t *state) const
+ * \li void presynaptic(precission_t v_pre), called once per presynaptic
+ * neuron before its synapses are stepped
+ * \li template <typename Integrator> void step(precission_t h,
+ * precission_t *state, precission_t v_pre)
+ * \li precission_t current(precission_t *state, precission_t weight,
+ * precission_t v_pre, precission_t v_post), the input to the
+ * postsynaptic neuron
+ * \li get(parameter) and set(parameter, value)
+ *
+ * Kinds driven by presynaptic spikes instead of the presynaptic voltage
+ * also provide
+ * \li precission_t threshold() const, the voltage defining a spike
+ * \li void on_spike(precission_t *state), called when a spike arrives
+ * and receive v_pre = 0 in step and current.
+ *
+ * The weight of each synapse scales its maximum conductance. Each kind
+ * follows the equations of the synapsis class of the same name, with one
+ * integrator step per step of the network. Synapses keep no integrator
+ * state, so the integrator must be stateless (see IntegratorConcept).
+ */
+
+/**
+ * @brief One direction of ElectricalSynapsis: the postsynaptic neuron
+ * receives weight * g * (v_pre - v_post). A gap junction needs a
+ * connection each way.
+ */
+template <typename precission = double>
+class ElectricalSynapsisKind {
+ public:
+  typedef precission precission_t;
+
+  enum parameter { g, n_parameters };
+
+  static constexpr int n_variables = 0;
+
+  struct ConstructorArgs {
+    precission_t params[n_parameters];
+  };
+
+ private:
+  precission_t m_parameters[n_parameters];
+
+ public:
+  ElectricalSynapsisKind(ConstructorArgs const &args) {
+    std::copy(args.params, args.params + n_parameters, m_parameters);
+  }
+
+  void initialise(precission_t *state) const {}
+
+  void presynaptic(precission_t v_pre) {}
+
+  template <typename Integrator>
+  void step(precission_t h, precission_t *state, precission_t v_pre) {}
+
+  precission_t current(precission_t *state, precission_t weight,
+                       precission_t v_pre, precission_t v_post) const {
+    return weight * m_parameters[g] * (v_pre - v_post);
+  }
+
+  precission_t get(parameter param) const { return m_parameters[param]; }
+
+  void set(parameter param, precission_t value) { m_parameters[param] = value; }
+};
+
+/**
+ * @brief Kind of GradualActivationSynapsis. State is r, s, i.
+ */
+template <typename precission = double, typename Math = neun::math::exact>
+class GradualActivationSynapsisKind {
+  typedef SystemWrapper<GradualActivationSynapsisModel<precission, Math>> System;
+
+ public:
+  typedef precission precission_t;
+  typedef typename System::parameter parameter;
+  typedef typename System::ConstructorArgs ConstructorArgs;
+
+  static constexpr int n_variables = System::n_variables;
+  static constexpr int n_parameters = System::n_parameters;
+
+ private:
+  System m_system;
+
+  /* Parameters with the voltage of the current presynaptic neuron */
+  precission_t m_parameters[n_parameters];
+
+ public:
+  GradualActivationSynapsisKind(ConstructorArgs const &args) : m_system(args) {
+    std::copy(args.params, args.params + n_parameters, m_parameters);
+  }
+
+  void initialise(precission_t *state) const {
+    std::fill(state, state + n_variables, precission_t(0));
+  }
+
+  void presynaptic(precission_t v_pre) { m_parameters[System::v_pre] = v_pre; }
+
+  template <typename Integrator>
+  void step(precission_t h, precission_t *state, precission_t v_pre) {
+    static_assert(IntegratorConcept<Integrator, System>,
+                  "Synapses are integrated without state, use a stateless integrator");
+
+    Integrator::step(m_system, h, state, m_parameters);
+  }
+
+  precission_t current(precission_t *state, precission_t weight,
+                       precission_t v_pre, precission_t v_post) const {
+    state[System::i] = weight * m_parameters[System::gsyn] * state[System::s] *
+                       (v_post - m_parameters[System::esyn]);
+
+    return state[System::i];
+  }
+
+  precission_t get(parameter param) const { return m_system.get(param); }
+
+  void set(parameter param, precission_t value) {
+    m_system.set(param, value);
+    m_parameters[param] = value;
+  }
+};
+
+/**
+ * @brief Kind of ChemicalSynapsis. State is mslow; the current,
+ * ifast + islow, goes to the postsynaptic neuron.
+ */
+template <typename precission = double>
+class ChemicalSynapsisKind {
+  typedef SystemWrapper<ChemicalSynapsisModel<precission>> System;
+
+ public:
+  typedef precission precission_t;
+  typedef typename System::parameter parameter;
+  typedef typename System::ConstructorArgs ConstructorArgs;
+
+  static constexpr int n_variables = System::n_variables;
+  static constexpr int n_parameters = System::n_parameters;
+
+ private:
+  System m_system;
+
+  /* Parameters with the voltage of the current presynaptic neuron */
+  precission_t m_parameters[n_parameters];
+
+  /* Fast activation, which only depends on the presynaptic neuron */
+  precission_t m_fast;
+
+ public:
+  ChemicalSynapsisKind(ConstructorArgs const &args) : m_system(args), m_fast(0) {
+    std::copy(args.params, args.params + n_parameters, m_parameters);
+  }
+
+  void initialise(precission_t *state) const {
+    std::fill(state, state + n_variables, precission_t(0));
+  }
+
+  void presynaptic(precission_t v_pre) {
+    m_parameters[System::v_pre] = v_pre;
+    m_fast = 1 / (1 + exp(m_parameters[System::sfast] * (m_parameters[System::Vfast] - v_pre)));
+  }
+
+  template <typename Integrator>
+  void step(precission_t h, precission_t *state, precission_t v_pre) {
+    static_assert(IntegratorConcept<Integrator, System>,
+                  "Synapses are integrated without state, use a stateless integrator");
+
+    Integrator::step(m_system, h, state, m_parameters);
+  }
+
+  /* (Golowasch, 1999) */
+  precission_t current(precission_t *state, precission_t weight,
+                       precission_t v_pre, precission_t v_post) const {
+    const precission_t ifast = m_parameters[System::gfast] * (v_post - m_parameters[System::Esyn]) * m_fast;
+    const precission_t islow = m_parameters[System::gslow] * state[System::mslow] *
+                               (v_post - m_parameters[System::Esyn]);
+
+    return weight * (ifast + islow);
+  }
+
+  precission_t get(parameter param) const { return m_system.get(param); }
+
+  void set(parameter param, precission_t value) {
+    m_system.set(param, value);
+    m_parameters[param] = value;
+  }
+};
+
+/**
+ * @brief Kind of DiffusionSynapsis, driven by presynaptic spikes. State
+ * is r, i and the release status (released, time since release).
+ */
+template <typename precission = double>
+class DiffusionSynapsisKind {
+  /* The model keeps the release flag as a member; it is set before every synapse */
+  struct System : public SystemWrapper<DiffusionSynapsisModel<precission>> {
+    using SystemWrapper<DiffusionSynapsisModel<precission>>::SystemWrapper;
+
+    void release(bool r) { this->m_release = r; }
+
+    precission *parameters() { return this->m_parameters; }
+  };
+
+ public:
+  typedef precission precission_t;
+  typedef typename System::parameter parameter;
+  typedef typename System::ConstructorArgs ConstructorArgs;
+
+  enum { released = System::n_variables, release_time };
+
+  static constexpr int n_variables = System::n_variables + 2;
+  static constexpr int n_parameters = System::n_parameters;
+
+ private:
+  System m_system;
+
+ public:
+  DiffusionSynapsisKind(ConstructorArgs const &args) : m_system(args) {}
+
+  void initialise(precission_t *state) const {
+    std::fill(state, state + n_variables, precission_t(0));
+  }
+
+  precission_t threshold() const { return m_system.get(System::threshold); }
+
+  void on_spike(precission_t *state) {
+    state[released] = 1;
+    state[release_time] = 0;
+  }
+
+  void presynaptic(precission_t v_pre) {}
+
+  template <typename Integrator>
+  void step(precission_t h, precission_t *state, precission_t v_pre) {
+    if (state[released] != 0) {
+      state[release_time] += h;
+
+      if (state[release_time] > m_system.get(System::max_release_time)) {
+        state[released] = 0;
+      }
+    }
+
+    m_system.release(state[released] != 0);
+
+    static_assert(IntegratorConcept<Integrator, System>,
+                  "Synapses are integrated without state, use a stateless integrator");
+
+    Integrator::step(m_system, h, state, m_system.parameters());
+  }
+
+  /* (Destexhe, 1994) */
+  precission_t current(precission_t *state, precission_t weight,
+                       precission_t v_pre, precission_t v_post) const {
+    state[System::i] = weight * m_system.get(System::gsyn) * state[System::r] *
+                       (v_post - m_system.get(System::esyn));
+
+    return state[System::i];
+  }
+
+  precission_t get(parameter param) const { return m_system.get(param); }
+
+  void set(parameter param, precission_t value) { m_system.set(param, value); }
+};
+
+#endif /*SYNAPSEKINDS_H_*/
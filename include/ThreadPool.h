@@ -0,0 +1,156 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed set of threads running parallel loops.
+ *
+ * run(tasks, f) calls f(task) for every task in [0, tasks), with the
+ * calling thread taking part, and returns when all of them are done.
+ * Tasks are not assigned in advance: every thread claims the next one
+ * from a shared counter as soon as it finishes the previous one, so
+ * threads that get cheap tasks take more of them. Which thread runs a task
+ * is therefore not fixed, and tasks must not depend on it.
+ */
+class ThreadPool {
+  std::vector<std::thread> m_threads;
+
+  std::mutex m_mutex;
+  std::condition_variable m_start;
+  std::condition_variable m_done;
+
+  std::function<void(int)> const *m_job = nullptr;
+  int m_tasks = 0;
+  std::atomic<int> m_next{0};
+
+  long m_generation = 0;
+  int m_busy = 0;
+  bool m_stop = false;
+
+  void work() {
+    for (int task; (task = m_next.fetch_add(1)) < m_tasks;) {
+      (*m_job)(task);
+    }
+  }
+
+  void worker() {
+    long generation = 0;
+
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_start.wait(lock, [&] { return m_stop || m_generation != generation; });
+
+        if (m_stop) {
+          return;
+        }
+
+        generation = m_generation;
+      }
+
+      work();
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      if (--m_busy == 0) {
+        m_done.notify_one();
+      }
+    }
+  }
+
+ public:
+  /**
+   * @param threads Total threads running each loop, including the caller.
+   * By default, one per hardware thread.
+   */
+  explicit ThreadPool(int threads = std::thread::hardware_concurrency()) {
+    for (int i = 1; i < threads; ++i) {
+      m_threads.emplace_back(&ThreadPool::worker, this);
+    }
+  }
+
+  ThreadPool(ThreadPool const &) = delete;
+  ThreadPool &operator=(ThreadPool const &) = delete;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+
+    m_start.notify_all();
+
+    for (std::thread &t : m_threads) {
+      t.join();
+    }
+  }
+
+  int threads() const { return m_threads.size() + 1; }
+
+  void run(int tasks, std::function<void(int)> const &f) {
+    if (m_threads.empty() || tasks <= 1) {
+      for (int task = 0; task < tasks; ++task) {
+        f(task);
+      }
+
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_job = &f;
+      m_tasks = tasks;
+      m_next = 0;
+      m_busy = m_threads.size();
+      ++m_generation;
+    }
+
+    m_start.notify_all();
+
+    work();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [&] { return m_busy == 0; });
+  }
+};
+
+#endif /*THREADPOOL_H_*/
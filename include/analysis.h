@@ -46,7 +46,7 @@ void advance_until_crossing_threshold(TNeuron &n, typename TNeuron::variable v,
 
 		lastx = x;
 		
-		x = n.get_variable(v);
+		x = n.get(v);
     }while(!(x >= threshold) || !(lastx < threshold));
 }
 
@@ -63,7 +63,7 @@ void advance_until_crossing_threshold_adding_input(TNeuron &n, typename TNeuron:
 
 		lastx = x;
 		
-		x = n.get_variable(v);
+		x = n.get(v);
     }while(!(x >= threshold) || !(lastx < threshold));
 }
 
@@ -71,7 +71,7 @@ template <typename TNeuron>
 unsigned int get_period(TNeuron &n, typename TNeuron::variable v, typename TNeuron::precission_t h, typename TNeuron::precission_t threshold)
 {
 	typename TNeuron::precission_t lastx;
-	typename TNeuron::precission_t x;
+	typename TNeuron::precission_t x = n.get(v);
 	
 	unsigned int period = 0;
 	 
@@ -81,7 +81,7 @@ unsigned int get_period(TNeuron &n, typename TNeuron::variable v, typename TNeur
 		period++;
 		
 		lastx = x;
-		x = n.get_variable(v);
+		x = n.get(v);
     }while(!(x >= threshold) || !(lastx < threshold));
     
     return period;
@@ -91,7 +91,7 @@ template <typename TNeuron>
 unsigned int get_period_adding_input(TNeuron &n, typename TNeuron::variable v, typename TNeuron::precission_t h, typename TNeuron::precission_t input, typename TNeuron::precission_t threshold)
 {
 	typename TNeuron::precission_t lastx;
-	typename TNeuron::precission_t x;
+	typename TNeuron::precission_t x = n.get(v);
 	
 	unsigned int period = 0;
 	 
@@ -103,11 +103,36 @@ unsigned int get_period_adding_input(TNeuron &n, typename TNeuron::variable v, t
 		period++;
 		
 		lastx = x;
-		x = n.get_variable(v);
+		x = n.get(v);
     }while(!(x >= threshold) || !(lastx < threshold));
     
     return period;
 }
 
+/**
+ * Steps n until its integrator reports an event and returns its time.
+ * n must be integrated with EventLocator and have a crossing registered.
+ */
+template <typename TNeuron>
+typename TNeuron::precission_t advance_until_event(TNeuron &n, typename TNeuron::precission_t h)
+{
+	do{
+		n.step(h);
+	}while(n.integrator_state().events.empty());
+
+	return n.integrator_state().events.front().time;
+}
+
+/**
+ * Time between two consecutive events of n, located within the step.
+ */
+template <typename TNeuron>
+typename TNeuron::precission_t get_event_period(TNeuron &n, typename TNeuron::precission_t h)
+{
+	typename TNeuron::precission_t first = advance_until_event(n, h);
+
+	return advance_until_event(n, h) - first;
+}
+
 
 #endif /*ANALYSIS_H_*/
@@ -0,0 +1,172 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef ADAMSBASHFORTHMOULTON_H_
+#define ADAMSBASHFORTHMOULTON_H_
+
+#include "SystemConcept.h"
+
+/**
+ * @class AdamsBashforthMoulton
+ *
+ * @brief Adams-Bashforth predictor with Adams-Moulton corrector (PECE).
+ *
+ * Derivatives of the last Steps points are kept in state_type, so each step
+ * costs two calls to eval whatever the order: one at the current point and
+ * one at the predicted point. The predictor is the Adams-Bashforth formula
+ * on k stored derivatives and the corrector the Adams-Moulton one on the
+ * same k plus the predicted point, which gives order k + 1.
+ *
+ * After a reset the history is empty and k grows from 1 (Heun's method) up
+ * to Steps as derivatives accumulate. The history is also discarded when h
+ * changes. Wrappers reset it whenever variables or parameters are changed
+ * from outside the integrator (set, post_step). There is no step without
+ * a state, which would run Heun's method on every call.
+ *
+ * Synaptic input is taken as constant along each step, as in the other
+ * integrators, so derivatives in the history keep the input of their step.
+ */
+template <int Steps = 4>
+class AdamsBashforthMoulton
+{
+	static_assert(Steps >= 1 && Steps <= 4, "Steps must be between 1 and 4");
+
+	/* bashforth[k - 1][j], weight of the derivative j steps back */
+	static constexpr double bashforth[4][4] = {
+		{1},
+		{3.0 / 2, -1.0 / 2},
+		{23.0 / 12, -16.0 / 12, 5.0 / 12},
+		{55.0 / 24, -59.0 / 24, 37.0 / 24, -9.0 / 24}
+	};
+
+	/* moulton[k - 1][0] weights the predicted point, [j + 1] as above */
+	static constexpr double moulton[4][5] = {
+		{1.0 / 2, 1.0 / 2},
+		{5.0 / 12, 8.0 / 12, -1.0 / 12},
+		{9.0 / 24, 19.0 / 24, -5.0 / 24, 1.0 / 24},
+		{251.0 / 720, 646.0 / 720, -264.0 / 720, 106.0 / 720, -19.0 / 720}
+	};
+
+public:
+	template <typename TSystem>
+	struct state_type
+	{
+		typedef typename TSystem::precission_t precission_t;
+
+		/* f[(head + j) % Steps] holds the derivatives j steps back */
+		precission_t f[Steps][TSystem::n_variables];
+
+		int head = 0;
+		int count = 0;
+
+		/* Step the history was built with */
+		precission_t h = 0;
+
+		void reset() { count = 0; }
+	};
+
+	template <typename TSystem>
+	static void step(TSystem &s,
+		typename TSystem::precission_t h,
+		typename TSystem::precission_t * const variables,
+		typename TSystem::precission_t * const parameters,
+		state_type<TSystem> &state)
+	{
+		static_assert(SystemConcept<TSystem>, "TSystem must satisfy SystemConcept");
+
+		if (h != state.h) {
+			state.count = 0;
+			state.h = h;
+		}
+
+		state.head = (state.head + Steps - 1) % Steps;
+		s.eval(variables, parameters, state.f[state.head]);
+
+		if (state.count < Steps) {
+			++state.count;
+		}
+
+		switch (state.count) {
+		case 1: advance<1>(s, h, variables, parameters, state); break;
+		case 2: advance<2>(s, h, variables, parameters, state); break;
+		case 3: advance<3>(s, h, variables, parameters, state); break;
+		default: advance<Steps>(s, h, variables, parameters, state); break;
+		}
+	}
+
+private:
+	template <int K, typename TSystem>
+	static void advance(TSystem &s,
+		typename TSystem::precission_t h,
+		typename TSystem::precission_t * const variables,
+		typename TSystem::precission_t * const parameters,
+		state_type<TSystem> &state)
+	{
+		typedef typename TSystem::precission_t precission_t;
+
+		const int dim = TSystem::n_variables;
+
+		precission_t const *f[K];
+
+		for (int j = 0; j < K; ++j) {
+			f[j] = state.f[(state.head + j) % Steps];
+		}
+
+		precission_t predicted[TSystem::n_variables];
+		precission_t fp[TSystem::n_variables];
+
+		for (int i = 0; i < dim; ++i) {
+			precission_t sum = 0;
+
+			for (int j = 0; j < K; ++j) {
+				sum += precission_t(bashforth[K - 1][j]) * f[j][i];
+			}
+
+			predicted[i] = variables[i] + h * sum;
+		}
+
+		s.eval(predicted, parameters, fp);
+
+		for (int i = 0; i < dim; ++i) {
+			precission_t sum = precission_t(moulton[K - 1][0]) * fp[i];
+
+			for (int j = 0; j < K; ++j) {
+				sum += precission_t(moulton[K - 1][j + 1]) * f[j][i];
+			}
+
+			variables[i] += h * sum;
+		}
+	}
+};
+
+#endif /*ADAMSBASHFORTHMOULTON_H_*/
@@ -0,0 +1,163 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef ADAPTIVERUNGEKUTTA_H_
+#define ADAPTIVERUNGEKUTTA_H_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "ExplicitRungeKutta.h"
+
+/**
+ * @class AdaptiveRungeKutta
+ *
+ * @brief Error controlled stepping for embedded Runge-Kutta tableaus.
+ *
+ * Besides the requirements of ExplicitRungeKutta, Tableau must provide
+ * \li static constexpr double b_hat[stages], the weights of the embedded
+ * lower order solution
+ * \li static constexpr int error_order, the order of that solution
+ * \li static constexpr bool fsal, true when the last stage is evaluated at
+ * the new solution and can be reused as the first stage of the next one
+ *
+ * Each call to step advances the system by exactly h, but internally splits
+ * it into as many sub-steps as the tolerances require. The size of the last
+ * accepted sub-step is kept in state_type so the next call starts from it
+ * instead of from h; wrappers store one state per system. There is no step
+ * without a state, which would forget the step size and the tolerances.
+ *
+ * Sub-steps are accepted when
+ * @f$\sqrt{\frac{1}{n}\sum_i \left(\frac{err_i}{abs\_tol + rel\_tol \cdot max(|x_i|, |x'_i|)}\right)^2} \le 1@f$
+ */
+template <typename Tableau>
+class AdaptiveRungeKutta : public ExplicitRungeKutta<Tableau>
+{
+	typedef ExplicitRungeKutta<Tableau> Base;
+
+public:
+	using Base::stages;
+
+	template <typename TSystem>
+	struct state_type
+	{
+		typedef typename TSystem::precission_t precission_t;
+
+		precission_t abs_tol = 1e-6;
+		precission_t rel_tol = 1e-4;
+
+		/* Proposed size of the next sub-step, 0 if unknown */
+		precission_t h_next = 0;
+
+		unsigned long accepted = 0;
+		unsigned long rejected = 0;
+
+		void reset() { h_next = 0; }
+	};
+
+	template <typename TSystem>
+	static void step(TSystem &s,
+		typename TSystem::precission_t h,
+		typename TSystem::precission_t * const variables,
+		typename TSystem::precission_t * const parameters,
+		state_type<TSystem> &state)
+	{
+		using namespace std;
+
+		static_assert(SystemConcept<TSystem>, "TSystem must satisfy SystemConcept");
+
+		typedef typename TSystem::precission_t precission_t;
+		typedef precission_t vars_type[TSystem::n_variables];
+
+		const int dim = TSystem::n_variables;
+
+		const precission_t h_min = h * 16 * numeric_limits<precission_t>::epsilon();
+		const precission_t exponent = -precission_t(1) / (Tableau::error_order + 1);
+
+		vars_type next;
+		vars_type k[stages];
+
+		precission_t t = 0;
+		precission_t hs = (state.h_next > 0) ? min(state.h_next, h) : h;
+
+		s.eval(variables, parameters, k[0]);
+
+		while (t < h) {
+			const bool last = (t + hs >= h - h_min);
+			const precission_t hc = last ? h - t : hs;
+
+			Base::eval_stages(s, hc, variables, parameters, k);
+
+			precission_t err = 0;
+
+			for (int i = 0; i < dim; ++i) {
+				next[i] = variables[i] + hc * Base::template combination<stages>(k, i);
+
+				precission_t e = hc * Base::template combination<stages + 1>(k, i);
+				precission_t sc = state.abs_tol + state.rel_tol * max(abs(variables[i]), abs(next[i]));
+
+				err += (e / sc) * (e / sc);
+			}
+
+			err = sqrt(err / dim);
+
+			/* Usual safety factor, growth limited to 5x and shrink to 0.2x */
+			precission_t factor = (err > 0) ? 0.9 * pow(err, exponent) : 5;
+			factor = min<precission_t>(5, max<precission_t>(0.2, factor));
+
+			if (err <= 1 || hc <= h_min) {
+				std::copy(next, next + dim, variables);
+
+				if constexpr (Tableau::fsal) {
+					std::copy(k[stages - 1], k[stages - 1] + dim, k[0]);
+				} else if (!last) {
+					s.eval(variables, parameters, k[0]);
+				}
+
+				t += hc;
+				++state.accepted;
+
+				/* A truncated last sub-step says little about the next one */
+				hs = last ? max(hs, hc * factor) : hc * factor;
+			} else {
+				++state.rejected;
+
+				hs = max(hc * factor, h_min);
+			}
+		}
+
+		state.h_next = hs;
+	}
+};
+
+#endif /*ADAPTIVERUNGEKUTTA_H_*/
@@ -0,0 +1,67 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef BOGACKISHAMPINE23_H_
+#define BOGACKISHAMPINE23_H_
+
+#include "AdaptiveRungeKutta.h"
+
+struct BogackiShampine23Tableau
+{
+	static constexpr int stages = 4;
+	static constexpr int error_order = 2;
+	static constexpr bool fsal = true;
+
+	static constexpr double a[stages][stages] = {
+		{},
+		{1.0 / 2},
+		{0, 3.0 / 4},
+		{2.0 / 9, 1.0 / 3, 4.0 / 9}
+	};
+
+	static constexpr double b[stages] = {2.0 / 9, 1.0 / 3, 4.0 / 9, 0};
+
+	static constexpr double b_hat[stages] = {7.0 / 24, 1.0 / 4, 1.0 / 3, 1.0 / 8};
+};
+
+/**
+ * @class BogackiShampine23
+ *
+ * @brief Embedded 3(2) Runge-Kutta method (Bogacki and Shampine, 1989) with
+ * error control. Cheaper than DormandPrince45 for loose tolerances.
+ */
+class BogackiShampine23 : public AdaptiveRungeKutta<BogackiShampine23Tableau>
+{
+};
+
+#endif /*BOGACKISHAMPINE23_H_*/
@@ -0,0 +1,71 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef CASHKARP45_H_
+#define CASHKARP45_H_
+
+#include "AdaptiveRungeKutta.h"
+
+struct CashKarp45Tableau
+{
+	static constexpr int stages = 6;
+	static constexpr int error_order = 4;
+	static constexpr bool fsal = false;
+
+	static constexpr double a[stages][stages] = {
+		{},
+		{1.0 / 5},
+		{3.0 / 40, 9.0 / 40},
+		{3.0 / 10, -9.0 / 10, 6.0 / 5},
+		{-11.0 / 54, 5.0 / 2, -70.0 / 27, 35.0 / 27},
+		{1631.0 / 55296, 175.0 / 512, 575.0 / 13824, 44275.0 / 110592, 253.0 / 4096}
+	};
+
+	static constexpr double b[stages] = {37.0 / 378, 0, 250.0 / 621, 125.0 / 594,
+		0, 512.0 / 1771};
+
+	static constexpr double b_hat[stages] = {2825.0 / 27648, 0, 18575.0 / 48384,
+		13525.0 / 55296, 277.0 / 14336, 1.0 / 4};
+};
+
+/**
+ * @class CashKarp45
+ *
+ * @brief Embedded 5(4) Runge-Kutta method (Cash and Karp, 1990) with error
+ * control. See AdaptiveRungeKutta.
+ */
+class CashKarp45 : public AdaptiveRungeKutta<CashKarp45Tableau>
+{
+};
+
+#endif /*CASHKARP45_H_*/
@@ -0,0 +1,72 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef DORMANDPRINCE45_H_
+#define DORMANDPRINCE45_H_
+
+#include "AdaptiveRungeKutta.h"
+
+struct DormandPrince45Tableau
+{
+	static constexpr int stages = 7;
+	static constexpr int error_order = 4;
+	static constexpr bool fsal = true;
+
+	static constexpr double a[stages][stages] = {
+		{},
+		{1.0 / 5},
+		{3.0 / 40, 9.0 / 40},
+		{44.0 / 45, -56.0 / 15, 32.0 / 9},
+		{19372.0 / 6561, -25360.0 / 2187, 64448.0 / 6561, -212.0 / 729},
+		{9017.0 / 3168, -355.0 / 33, 46732.0 / 5247, 49.0 / 176, -5103.0 / 18656},
+		{35.0 / 384, 0, 500.0 / 1113, 125.0 / 192, -2187.0 / 6784, 11.0 / 84}
+	};
+
+	static constexpr double b[stages] = {35.0 / 384, 0, 500.0 / 1113, 125.0 / 192,
+		-2187.0 / 6784, 11.0 / 84, 0};
+
+	static constexpr double b_hat[stages] = {5179.0 / 57600, 0, 7571.0 / 16695, 393.0 / 640,
+		-92097.0 / 339200, 187.0 / 2100, 1.0 / 40};
+};
+
+/**
+ * @class DormandPrince45
+ *
+ * @brief Embedded 5(4) Runge-Kutta method (Dormand and Prince, 1980) with
+ * error control. See AdaptiveRungeKutta.
+ */
+class DormandPrince45 : public AdaptiveRungeKutta<DormandPrince45Tableau>
+{
+};
+
+#endif /*DORMANDPRINCE45_H_*/
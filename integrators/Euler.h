@@ -35,30 +35,24 @@ $Id: Euler.h 184 2007-06-04 11:26:12Z elferdo $
 #ifndef EULER_H_
 #define EULER_H_
 
-#include "SystemConcept.h"
+#include "ExplicitRungeKutta.h"
 
-
-class Euler
+struct EulerTableau
 {
-public:
-	template <typename TSystem>
-	static void step(TSystem &s, typename TSystem::precission_t h, typename TSystem::precission_t * const variables, typename TSystem::precission_t * const parameters)
-	{
-		using namespace std;
-
-		static_assert(SystemConcept<TSystem>, "TSystem must satisfy SystemConcept");
-
-		typename TSystem::precission_t results[TSystem::n_variables];
+	static constexpr int stages = 1;
 
-		const int dim = TSystem::n_variables;
+	static constexpr double a[stages][stages] = {{}};
 
-		s.eval(variables, parameters, results);
-
-		for(int i = 0; i < dim; ++i){
-			variables[i] += h * results[i];
-		}
-	}
+	static constexpr double b[stages] = {1};
 };
 
+/**
+ * @class Euler
+ *
+ * @brief Forward Euler method, the one stage explicit Runge-Kutta method.
+ */
+class Euler : public ExplicitRungeKutta<EulerTableau>
+{
+};
 
 #endif /*EULER_H_*/
@@ -0,0 +1,86 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef EULERMARUYAMA_H_
+#define EULERMARUYAMA_H_
+
+#include <cmath>
+#include "StochasticModelConcept.h"
+#include "NoiseStream.h"
+
+/**
+ * @class EulerMaruyama
+ *
+ * @brief Strong order 0.5 integrator for Itô SDEs:
+ * @f$x' = x + f(x) h + g(x) \Delta W@f$, with @f$\Delta W \sim N(0, h)@f$.
+ *
+ * The system must satisfy StochasticModelConcept. Every system draws from
+ * its own NoiseStream, kept by the wrapper or the container as integrator
+ * state, so there is no step without state. Streams must be keyed before
+ * the first step (see NoiseStream).
+ */
+class EulerMaruyama
+{
+public:
+	template <typename TSystem>
+	using state_type = NoiseStream<typename TSystem::precission_t>;
+
+	template <typename TSystem>
+	static void step(TSystem &s,
+		typename TSystem::precission_t h,
+		typename TSystem::precission_t * const variables,
+		typename TSystem::precission_t * const parameters,
+		state_type<TSystem> &state)
+	{
+		using namespace std;
+
+		static_assert(StochasticModelConcept<TSystem>, "TSystem must satisfy StochasticModelConcept");
+
+		typedef typename TSystem::precission_t vars_type[TSystem::n_variables];
+
+		vars_type f, g, dw;
+
+		const int dim = TSystem::n_variables;
+		const typename TSystem::precission_t sqrt_h = sqrt(h);
+
+		s.eval(variables, parameters, f);
+		s.diffusion(variables, parameters, g);
+		state.normals(dw, dim);
+
+		for (int i = 0; i < dim; ++i) {
+			variables[i] += h * f[i] + g[i] * sqrt_h * dw[i];
+		}
+	}
+};
+
+#endif /*EULERMARUYAMA_H_*/
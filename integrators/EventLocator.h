@@ -0,0 +1,227 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef EVENTLOCATOR_H_
+#define EVENTLOCATOR_H_
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include "Checkpoint.h"
+#include "SystemConcept.h"
+#include "IntegratorConcept.h"
+#include "IntegratorState.h"
+
+/**
+ * @class EventLocator
+ *
+ * @brief Adds threshold crossing detection to another integrator.
+ *
+ * Crossings are registered in the state (see add_crossing). After every
+ * step of Integrator, the registered variables are checked for a sign
+ * change with respect to their threshold. When one is found, the crossing
+ * time is located on the cubic Hermite interpolant built from the values
+ * and derivatives at both ends of the step, so event times are not
+ * quantised to h. The derivatives are only evaluated on steps with an
+ * event.
+ *
+ * Events of the last step are left in state.events, with times measured
+ * from the construction of the state or its last restart_clock(). Wrappers
+ * reset() the state on discontinuous changes (a set(), or a spike reset in
+ * post_step), which only restarts Integrator, so the clock keeps running
+ * and event times stay those of the simulation. The time is accumulated in
+ * double whatever the precision of the system, so that it does not drift
+ * over long runs in float. Checkpoints save the state with the crossings,
+ * events and time (see neun::checkpoint::write_state).
+ */
+template <typename Integrator>
+class EventLocator
+{
+public:
+	template <typename TSystem>
+	struct state_type
+	{
+		typedef typename TSystem::precission_t precission_t;
+
+		enum direction { downwards = -1, any = 0, upwards = 1 };
+
+		struct crossing
+		{
+			int variable;
+			precission_t threshold;
+			direction dir;
+		};
+
+		struct event
+		{
+			int crossing;
+			precission_t time;
+		};
+
+		std::vector<crossing> crossings;
+		std::vector<event> events;
+
+		double time = 0;
+
+		typename IntegratorState<Integrator, TSystem>::type integrator;
+
+		/**
+		 * Registers a crossing of variable v through threshold and returns
+		 * its index, which is reported back in event::crossing.
+		 */
+		int add_crossing(typename TSystem::variable v, precission_t threshold, direction dir = upwards)
+		{
+			crossings.push_back(crossing{v, threshold, dir});
+
+			return crossings.size() - 1;
+		}
+
+		void reset()
+		{
+			integrator.reset();
+		}
+
+		/* Measures event times from now on */
+		void restart_clock()
+		{
+			time = 0;
+			events.clear();
+		}
+
+		void save(std::ostream &os) const
+		{
+			neun::checkpoint::write_vector(os, crossings);
+			neun::checkpoint::write_vector(os, events);
+			neun::checkpoint::write(os, time);
+			neun::checkpoint::write_state(os, integrator);
+		}
+
+		void load(std::istream &is)
+		{
+			neun::checkpoint::read_vector(is, crossings);
+			neun::checkpoint::read_vector(is, events);
+			neun::checkpoint::read(is, time);
+			neun::checkpoint::read_state(is, integrator);
+		}
+	};
+
+	/* Without a state there is nothing to locate, so Integrator must not need one */
+	template <typename TSystem>
+	requires IntegratorConcept<Integrator, TSystem>
+	static void step(TSystem &s,
+		typename TSystem::precission_t h,
+		typename TSystem::precission_t * const variables,
+		typename TSystem::precission_t * const parameters)
+	{
+		Integrator::step(s, h, variables, parameters);
+	}
+
+	template <typename TSystem>
+	static void step(TSystem &s,
+		typename TSystem::precission_t h,
+		typename TSystem::precission_t * const variables,
+		typename TSystem::precission_t * const parameters,
+		state_type<TSystem> &state)
+	{
+		static_assert(SystemConcept<TSystem>, "TSystem must satisfy SystemConcept");
+
+		typedef typename TSystem::precission_t precission_t;
+		typedef precission_t vars_type[TSystem::n_variables];
+
+		const int dim = TSystem::n_variables;
+
+		vars_type start, f0, f1;
+		bool derivatives = false;
+
+		std::copy(variables, variables + dim, start);
+
+		integrator_step<Integrator, TSystem>(s, h, variables, parameters, state.integrator);
+
+		state.events.clear();
+
+		for (int c = 0; c < (int)state.crossings.size(); ++c) {
+			const typename state_type<TSystem>::crossing &cr = state.crossings[c];
+
+			const precission_t g0 = start[cr.variable] - cr.threshold;
+			const precission_t g1 = variables[cr.variable] - cr.threshold;
+
+			const bool up = (g0 < 0 && g1 >= 0);
+			const bool down = (g0 > 0 && g1 <= 0);
+
+			if (!((up && cr.dir >= 0) || (down && cr.dir <= 0))) {
+				continue;
+			}
+
+			if (!derivatives) {
+				s.eval(start, parameters, f0);
+				s.eval(variables, parameters, f1);
+				derivatives = true;
+			}
+
+			const precission_t theta = locate(h, g0, f0[cr.variable], g1, f1[cr.variable]);
+
+			state.events.push_back(typename state_type<TSystem>::event{c, precission_t(state.time + theta * h)});
+		}
+
+		std::sort(state.events.begin(), state.events.end(),
+			[](auto const &a, auto const &b) { return a.time < b.time; });
+
+		state.time += h;
+	}
+
+private:
+	/* Root in [0, 1] of the Hermite cubic through (0, g0, d0) and (1, g1, d1) */
+	template <typename Precission>
+	static Precission locate(Precission h, Precission g0, Precission d0, Precission g1, Precission d1)
+	{
+		Precission lo = 0, hi = 1;
+
+		for (int i = 0; i < 40; ++i) {
+			const Precission t = (lo + hi) / 2;
+			const Precission t2 = t * t, t3 = t2 * t;
+
+			const Precission g = (2 * t3 - 3 * t2 + 1) * g0 + (t3 - 2 * t2 + t) * h * d0
+				+ (-2 * t3 + 3 * t2) * g1 + (t3 - t2) * h * d1;
+
+			if ((g < 0) == (g0 < 0)) {
+				lo = t;
+			} else {
+				hi = t;
+			}
+		}
+
+		return (lo + hi) / 2;
+	}
+};
+
+#endif /*EVENTLOCATOR_H_*/
@@ -0,0 +1,269 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef EXPLICITRUNGEKUTTA_H_
+#define EXPLICITRUNGEKUTTA_H_
+
+#include <utility>
+#include "SystemConcept.h"
+
+/**
+ * @class ExplicitRungeKutta
+ *
+ * @brief Explicit Runge-Kutta method generated from its Butcher tableau.
+ *
+ * Tableau must provide
+ * \li static constexpr int stages
+ * \li static constexpr double a[stages][stages]
+ * \li static constexpr double b[stages]
+ *
+ * Stages are unrolled at compile time and terms whose coefficient is zero
+ * are not emitted, so a tableau is as fast as the equivalent hand written
+ * code. Each stage is accumulated in a single pass over the variables.
+ */
+template <typename Tableau>
+class ExplicitRungeKutta
+{
+public:
+	static constexpr int stages = Tableau::stages;
+
+	template <typename TSystem>
+	static void step(TSystem &s,
+		typename TSystem::precission_t h,
+		typename TSystem::precission_t * const variables,
+		typename TSystem::precission_t * const parameters)
+	{
+		static_assert(SystemConcept<TSystem>, "TSystem must satisfy SystemConcept");
+
+		typedef typename TSystem::precission_t vars_type[TSystem::n_variables];
+
+		vars_type k[stages];
+
+		const int dim = TSystem::n_variables;
+
+		s.eval(variables, parameters, k[0]);
+
+		eval_stages(s, h, variables, parameters, k);
+
+		for (int i = 0; i < dim; ++i) {
+			variables[i] += h * combination<stages>(k, i);
+		}
+	}
+
+	/**
+	 * Advances N instances of the same model in lockstep.
+	 *
+	 * Variables are stored as structure of arrays, variables[v][lane], so
+	 * that every stage combination runs over contiguous lanes and can be
+	 * vectorised by the compiler. s[lane] provides eval (and its synaptic
+	 * input) for each lane, so plain models can be used as well as systems;
+	 * lanes may share the same parameters array. Plain models with a
+	 * parameter hook (ParameterHookConcept) must have been given their
+	 * parameters through it.
+	 */
+	template <typename TSystem, int N>
+	static void step_batch(TSystem (&s)[N],
+		typename TSystem::precission_t h,
+		typename TSystem::precission_t (&variables)[TSystem::n_variables][N],
+		typename TSystem::precission_t * const (&parameters)[N])
+	{
+		static_assert(ModelConcept<TSystem>, "TSystem must satisfy ModelConcept");
+
+		typedef typename TSystem::precission_t precission_t;
+		typedef precission_t lanes_type[TSystem::n_variables][N];
+
+		lanes_type k[stages];
+
+		const int dim = TSystem::n_variables;
+
+		eval_batch(s, variables, parameters, k[0]);
+
+		[&]<int... Stage>(std::integer_sequence<int, Stage...>) {
+			(eval_stage_batch<Stage + 1>(s, h, variables, parameters, k), ...);
+		}(std::make_integer_sequence<int, stages - 1>{});
+
+		for (int i = 0; i < dim; ++i) {
+			for (int l = 0; l < N; ++l) {
+				variables[i][l] += h * combination_batch<stages>(k, i, l);
+			}
+		}
+	}
+
+	/**
+	 * Computes k[1] ... k[stages - 1]. k[0] must already hold the
+	 * derivatives at variables.
+	 */
+	template <typename TSystem>
+	static void eval_stages(TSystem &s,
+		typename TSystem::precission_t h,
+		typename TSystem::precission_t const * const variables,
+		typename TSystem::precission_t * const parameters,
+		typename TSystem::precission_t (* const k)[TSystem::n_variables])
+	{
+		[&]<int... Stage>(std::integer_sequence<int, Stage...>) {
+			(eval_stage<Stage + 1>(s, h, variables, parameters, k), ...);
+		}(std::make_integer_sequence<int, stages - 1>{});
+	}
+
+	/**
+	 * Weighted sum of the stages for variable i. Row selects the weights:
+	 * rows of a for Row < stages, b for Row == stages and b - b_hat (the
+	 * error estimate of embedded tableaus) for Row == stages + 1.
+	 */
+	template <int Row, typename Precission, int Dim>
+	static Precission combination(Precission const (* const k)[Dim], int i)
+	{
+		constexpr auto nz = nonzero<Row>();
+
+		if constexpr (nz.count == 0) {
+			return 0;
+		} else {
+			return [&]<int... J>(std::integer_sequence<int, J...>) {
+				return ((Precission(coefficient<Row>(nz.index[J])) * k[nz.index[J]][i]) + ...);
+			}(std::make_integer_sequence<int, nz.count>{});
+		}
+	}
+
+private:
+	template <int Row>
+	static constexpr double coefficient(int j)
+	{
+		if constexpr (Row < stages) {
+			return Tableau::a[Row][j];
+		} else if constexpr (Row == stages) {
+			return Tableau::b[j];
+		} else {
+			return Tableau::b[j] - Tableau::b_hat[j];
+		}
+	}
+
+	struct nonzero_type
+	{
+		int index[stages] = {};
+		int count = 0;
+	};
+
+	template <int Row>
+	static constexpr nonzero_type nonzero()
+	{
+		nonzero_type nz;
+		const int columns = (Row < stages) ? Row : stages;
+
+		for (int j = 0; j < columns; ++j) {
+			if (coefficient<Row>(j) != 0) {
+				nz.index[nz.count++] = j;
+			}
+		}
+
+		return nz;
+	}
+
+	template <int Stage, typename TSystem>
+	static void eval_stage(TSystem &s,
+		typename TSystem::precission_t h,
+		typename TSystem::precission_t const * const variables,
+		typename TSystem::precission_t * const parameters,
+		typename TSystem::precission_t (* const k)[TSystem::n_variables])
+	{
+		typename TSystem::precission_t apoyo[TSystem::n_variables];
+
+		const int dim = TSystem::n_variables;
+
+		for (int i = 0; i < dim; ++i) {
+			apoyo[i] = variables[i] + h * combination<Stage>(k, i);
+		}
+
+		s.eval(apoyo, parameters, k[Stage]);
+	}
+
+	template <int Row, typename Precission, int Dim, int N>
+	static Precission combination_batch(Precission const (* const k)[Dim][N], int i, int l)
+	{
+		constexpr auto nz = nonzero<Row>();
+
+		if constexpr (nz.count == 0) {
+			return 0;
+		} else {
+			return [&]<int... J>(std::integer_sequence<int, J...>) {
+				return ((Precission(coefficient<Row>(nz.index[J])) * k[nz.index[J]][i][l]) + ...);
+			}(std::make_integer_sequence<int, nz.count>{});
+		}
+	}
+
+	/* Models evaluate one lane at a time, so lanes are gathered and scattered */
+	template <typename TSystem, int N>
+	static void eval_batch(TSystem (&s)[N],
+		typename TSystem::precission_t const (&variables)[TSystem::n_variables][N],
+		typename TSystem::precission_t * const (&parameters)[N],
+		typename TSystem::precission_t (&incs)[TSystem::n_variables][N])
+	{
+		typename TSystem::precission_t lane_vars[TSystem::n_variables];
+		typename TSystem::precission_t lane_incs[TSystem::n_variables];
+
+		const int dim = TSystem::n_variables;
+
+		for (int l = 0; l < N; ++l) {
+			for (int i = 0; i < dim; ++i) {
+				lane_vars[i] = variables[i][l];
+			}
+
+			s[l].eval(lane_vars, parameters[l], lane_incs);
+
+			for (int i = 0; i < dim; ++i) {
+				incs[i][l] = lane_incs[i];
+			}
+		}
+	}
+
+	template <int Stage, typename TSystem, int N>
+	static void eval_stage_batch(TSystem (&s)[N],
+		typename TSystem::precission_t h,
+		typename TSystem::precission_t const (&variables)[TSystem::n_variables][N],
+		typename TSystem::precission_t * const (&parameters)[N],
+		typename TSystem::precission_t (* const k)[TSystem::n_variables][N])
+	{
+		typename TSystem::precission_t apoyo[TSystem::n_variables][N];
+
+		const int dim = TSystem::n_variables;
+
+		for (int i = 0; i < dim; ++i) {
+			for (int l = 0; l < N; ++l) {
+				apoyo[i][l] = variables[i][l] + h * combination_batch<Stage>(k, i, l);
+			}
+		}
+
+		eval_batch(s, apoyo, parameters, k[Stage]);
+	}
+};
+
+#endif /*EXPLICITRUNGEKUTTA_H_*/
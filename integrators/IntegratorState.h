@@ -0,0 +1,78 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef INTEGRATORSTATE_H_
+#define INTEGRATORSTATE_H_
+
+#include "StatefulIntegratorConcept.h"
+
+/**
+ * \brief Storage a wrapper keeps for its integrator.
+ *
+ * Stateless integrators get an empty type, so wrappers using them do not
+ * grow at all.
+ */
+template <typename Integrator, typename System>
+struct IntegratorState
+{
+	struct type
+	{
+		void reset() {}
+	};
+};
+
+template <typename Integrator, typename System>
+requires StatefulIntegratorConcept<Integrator, System>
+struct IntegratorState<Integrator, System>
+{
+	typedef typename Integrator::template state_type<System> type;
+};
+
+/**
+ * \brief Calls the stateful overload of Integrator::step when there is one.
+ */
+template <typename Integrator, typename System>
+void integrator_step(System &s,
+	typename System::precission_t h,
+	typename System::precission_t * const variables,
+	typename System::precission_t * const parameters,
+	typename IntegratorState<Integrator, System>::type &state)
+{
+	if constexpr (StatefulIntegratorConcept<Integrator, System>) {
+		Integrator::template step<System>(s, h, variables, parameters, state);
+	} else {
+		Integrator::template step<System>(s, h, variables, parameters);
+	}
+}
+
+#endif /*INTEGRATORSTATE_H_*/
@@ -0,0 +1,104 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef NOISESTREAM_H_
+#define NOISESTREAM_H_
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include "Philox.h"
+
+/**
+ * @brief Gaussian noise of one system, used as state by the stochastic
+ * integrators.
+ *
+ * Numbers are drawn from Philox keyed by (id, seed) with the step index as
+ * counter. Streams start unkeyed and must be given their id with key()
+ * before drawing: wrappers leave it to the user (through
+ * integrator_state()), containers key every element by its index, so runs
+ * are reproducible whatever the construction order or the threads. Copies
+ * keep the key, and draw the same numbers as the original.
+ */
+template <typename Precission>
+struct NoiseStream
+{
+	static constexpr std::uint32_t unkeyed = 0xffffffff;
+
+	std::uint32_t seed = 0;
+	std::uint32_t id = unkeyed;
+	std::uint64_t counter = 0;
+
+	/* Restarts the stream as number id of the simulation seeded with seed */
+	void key(std::uint32_t id, std::uint32_t seed = 0)
+	{
+		this->id = id;
+		this->seed = seed;
+		counter = 0;
+	}
+
+	bool keyed() const { return id != unkeyed; }
+
+	/* Fills out with n independent N(0, 1) samples and advances one step */
+	void normals(Precission * const out, const int n)
+	{
+		if (!keyed()) {
+			throw std::logic_error("NoiseStream: draw from a stream without key");
+		}
+
+		const double two_pi = 6.283185307179586;
+
+		for (int i = 0; i < n; i += 2) {
+			Philox::block c = {{std::uint32_t(counter), std::uint32_t(counter >> 32),
+				std::uint32_t(i / 2), 0}};
+			Philox::block r = Philox::generate(c, id, seed);
+
+			/* Box-Muller */
+			const double radius = std::sqrt(-2 * std::log(Philox::to_uniform(r.v[0], r.v[1])));
+			const double angle = two_pi * Philox::to_uniform(r.v[2], r.v[3]);
+
+			out[i] = radius * std::cos(angle);
+
+			if (i + 1 < n) {
+				out[i + 1] = radius * std::sin(angle);
+			}
+		}
+
+		++counter;
+	}
+
+	/* The noise must go on after a discontinuity, so nothing to do */
+	void reset() {}
+};
+
+#endif /*NOISESTREAM_H_*/
@@ -0,0 +1,214 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef ROSENBROCK2_H_
+#define ROSENBROCK2_H_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "SystemConcept.h"
+#include "JacobianModelConcept.h"
+
+/**
+ * @class Rosenbrock2
+ *
+ * @brief Linearly implicit 2nd order Rosenbrock-W method ROS2 (Verwer et
+ * al., 1999) for stiff systems.
+ *
+ * The method is L-stable and keeps its order with an approximate Jacobian,
+ * so h is bounded by accuracy rather than by stability. The Jacobian is
+ * taken from the system when it satisfies JacobianModelConcept and is
+ * computed by forward finite differences over eval otherwise.
+ *
+ * With @f$\gamma = 1 + 1/\sqrt{2}@f$ and @f$W = I - \gamma h J@f$:
+ *
+ * @f$W k_1 = f(x)@f$
+ *
+ * @f$W k_2 = f(x + h k_1) - 2 k_1@f$
+ *
+ * @f$x' = x + \frac{3}{2} h k_1 + \frac{1}{2} h k_2@f$
+ */
+class Rosenbrock2
+{
+public:
+	template <typename TSystem>
+	static void step(TSystem &s,
+		typename TSystem::precission_t h,
+		typename TSystem::precission_t * const variables,
+		typename TSystem::precission_t * const parameters)
+	{
+		using namespace std;
+
+		static_assert(SystemConcept<TSystem>, "TSystem must satisfy SystemConcept");
+
+		typedef typename TSystem::precission_t precission_t;
+		typedef precission_t vars_type[TSystem::n_variables];
+
+		const int dim = TSystem::n_variables;
+		const precission_t gamma = 1 + 1 / sqrt(precission_t(2));
+
+		vars_type f0, apoyo, k1, k2;
+		precission_t w[TSystem::n_variables * TSystem::n_variables];
+		int pivots[TSystem::n_variables];
+
+		s.eval(variables, parameters, f0);
+
+		jacobian(s, variables, parameters, f0, w);
+
+		for (int i = 0; i < dim * dim; ++i) {
+			w[i] *= -gamma * h;
+		}
+
+		for (int i = 0; i < dim; ++i) {
+			w[i * dim + i] += 1;
+		}
+
+		lu_decompose(w, pivots, dim);
+
+		std::copy(f0, f0 + dim, k1);
+		lu_solve(w, pivots, k1, dim);
+
+		for (int i = 0; i < dim; ++i) {
+			apoyo[i] = variables[i] + h * k1[i];
+		}
+
+		s.eval(apoyo, parameters, k2);
+
+		for (int i = 0; i < dim; ++i) {
+			k2[i] -= 2 * k1[i];
+		}
+
+		lu_solve(w, pivots, k2, dim);
+
+		for (int i = 0; i < dim; ++i) {
+			variables[i] += h * (1.5 * k1[i] + 0.5 * k2[i]);
+		}
+	}
+
+private:
+	template <typename TSystem>
+	static void jacobian(TSystem &s,
+		typename TSystem::precission_t * const variables,
+		typename TSystem::precission_t * const parameters,
+		typename TSystem::precission_t const * const f0,
+		typename TSystem::precission_t * const jac)
+	{
+		using namespace std;
+
+		typedef typename TSystem::precission_t precission_t;
+
+		const int dim = TSystem::n_variables;
+
+		if constexpr (JacobianModelConcept<TSystem>) {
+			s.jacobian(variables, parameters, jac);
+		} else {
+			precission_t apoyo[TSystem::n_variables], f1[TSystem::n_variables];
+
+			std::copy(variables, variables + dim, apoyo);
+
+			for (int j = 0; j < dim; ++j) {
+				const precission_t delta = sqrt(numeric_limits<precission_t>::epsilon())
+					* max<precission_t>(abs(variables[j]), 1);
+
+				apoyo[j] = variables[j] + delta;
+				s.eval(apoyo, parameters, f1);
+				apoyo[j] = variables[j];
+
+				for (int i = 0; i < dim; ++i) {
+					jac[i * dim + j] = (f1[i] - f0[i]) / delta;
+				}
+			}
+		}
+	}
+
+	/* In place LU decomposition with partial pivoting */
+	template <typename Precission>
+	static void lu_decompose(Precission * const a, int * const pivots, const int dim)
+	{
+		using namespace std;
+
+		for (int k = 0; k < dim; ++k) {
+			int p = k;
+
+			for (int i = k + 1; i < dim; ++i) {
+				if (abs(a[i * dim + k]) > abs(a[p * dim + k])) {
+					p = i;
+				}
+			}
+
+			pivots[k] = p;
+
+			if (p != k) {
+				for (int j = 0; j < dim; ++j) {
+					swap(a[k * dim + j], a[p * dim + j]);
+				}
+			}
+
+			for (int i = k + 1; i < dim; ++i) {
+				a[i * dim + k] /= a[k * dim + k];
+
+				for (int j = k + 1; j < dim; ++j) {
+					a[i * dim + j] -= a[i * dim + k] * a[k * dim + j];
+				}
+			}
+		}
+	}
+
+	template <typename Precission>
+	static void lu_solve(Precission const * const a, int const * const pivots,
+		Precission * const b, const int dim)
+	{
+		using namespace std;
+
+		for (int k = 0; k < dim; ++k) {
+			swap(b[k], b[pivots[k]]);
+		}
+
+		for (int i = 1; i < dim; ++i) {
+			for (int j = 0; j < i; ++j) {
+				b[i] -= a[i * dim + j] * b[j];
+			}
+		}
+
+		for (int i = dim - 1; i >= 0; --i) {
+			for (int j = i + 1; j < dim; ++j) {
+				b[i] -= a[i * dim + j] * b[j];
+			}
+
+			b[i] /= a[i * dim + i];
+		}
+	}
+};
+
+#endif /*ROSENBROCK2_H_*/
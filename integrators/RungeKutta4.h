@@ -35,53 +35,24 @@ $Id: RungeKutta4.h 184 2007-06-04 11:26:12Z elferdo $
 #ifndef RUNGEKUTTA4_H_
 #define RUNGEKUTTA4_H_
 
-#include "SystemConcept.h"
+#include "ExplicitRungeKutta.h"
 
-
-class RungeKutta4
+struct RungeKutta4Tableau
 {
-public:
-	template <typename TSystem>
-	static void step(TSystem &s, 
-		typename TSystem::precission_t h, 
-		typename TSystem::precission_t * const variables, 
-		typename TSystem::precission_t * const parameters)
-	{
-		using namespace std;
-
-		static_assert(SystemConcept<TSystem>, "TSystem must satisfy SystemConcept");
-
-		typedef typename TSystem::precission_t vars_type[TSystem::n_variables];
-
-		vars_type apoyo, retorno;
-		vars_type k[4];
-
-		const int dim = TSystem::n_variables;
-
-		s.eval(variables, parameters, k[0]);
-
-		for (int i = 0; i < dim; ++i) {
-			apoyo[i] = variables[i] + k[0][i] * h / 2;
-		}
+	static constexpr int stages = 4;
 
-		s.eval(apoyo, parameters, k[1]);
+	static constexpr double a[stages][stages] = {
+		{},
+		{0.5},
+		{0, 0.5},
+		{0, 0, 1}
+	};
 
-		for (int i = 0; i < dim; ++i) {
-			apoyo[i] = variables[i] + k[1][i] * h / 2;
-		}
-
-		s.eval(apoyo, parameters, k[2]);
-
-		for (int i = 0; i < dim; ++i) {
-			apoyo[i] = variables[i] + k[2][i] * h;
-		}
-
-		s.eval(apoyo, parameters, k[3]);
+	static constexpr double b[stages] = {1.0 / 6, 1.0 / 3, 1.0 / 3, 1.0 / 6};
+};
 
-		for(int j = 0; j < dim; ++j){
-			variables[j] += h / 6 * (k[0][j] + 2 * k[1][j] + 2 * k[2][j] + k[3][j]);
-		}
-	}
+class RungeKutta4 : public ExplicitRungeKutta<RungeKutta4Tableau>
+{
 };
 
 /**
@@ -89,51 +60,23 @@ public:
  *
  * @brief Implementation of the 4th order Runge-Kutta integration method.
  *
- * @fn void RungeKutta4::step(double const &t, double const &h, TSystem &s, typename TSystem::variables_list_type &variables, typename TSystem::variables_list_type &increments)
- * @param t Simulation time
- * @param h Increment of simulation time
+ * @fn void RungeKutta4::step(TSystem &s, precission_t h, precission_t * const variables, precission_t * const parameters)
  * @param s System to be simulated
- * @param[in] variables Array consisting of the variables of the system
- * @param[out] increments Array where the calculated increments will be stored
+ * @param h Increment of simulation time
+ * @param[in,out] variables Array consisting of the variables of the system
+ * @param parameters Array consisting of the parameters of the system
  *
  * This method implements the following algorithm in "parallel" for all
  * variables of the system:
  *
  *
  * @f$\dot x = f(t, x)@f$
-@f$ 		ret=f(t, x)@f$
-
-@f$		k0 = h * ret@f$
-@f$		x'=x + k0 * .2@f$
-
-@f$		ret=f(t + h / 5, x')@f$
-
-@f$		k1 = h * ret@f$
-@f$		x'=x + k0 * 0.075 + k1 * 0.225@f$
-
-@f$		ret=f(t + h * 0.3, x')		@f$
-
-@f$		k2 = h * ret @f$
-
-@f$		x' = x + k0 * .3 - k1 * 0.9 + k2 * 1.2 @f$
-
-@f$		ret = f(t + h * 0.6, x')@f$
-
-@f$		k3 = h * ret @f$
-
-@f$		x' = x + k0 * 0.075 + k1 * 0.675 - k2 * 0.6 + k3 * 0.75 @f$
-
-@f$		ret=f(t + h * 0.9, x') @f$
-
-@f$		k4 = h * ret @f$
-
-@f$		x' = x + k0 * 0.660493827160493 + k1 * 2.5 - k2 * 5.185185185185185 + k3 * 3.888888888888889 - k4 * 0.864197530864197 @f$
-
-@f$		ret = f(t + h, x') @f$
-
-@f$		k5 = h * ret @f$
+@f$		k0 = f(t, x)@f$
+@f$		k1 = f(t + h / 2, x + k0 * h / 2)@f$
+@f$		k2 = f(t + h / 2, x + k1 * h / 2)@f$
+@f$		k3 = f(t + h, x + k2 * h)@f$
 
-@f$		\delta x = k0 * 0.098765432098765 + k2 * 0.396825396825396 + k3 * 0.231481481481481 + k4 * 0.308641975308641 - k5 * 0.035714285714285 @f$
+@f$		\delta x = h / 6 * (k0 + 2 * k1 + 2 * k2 + k3) @f$
 
  */
 
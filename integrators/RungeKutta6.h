@@ -35,92 +35,27 @@ $Id: RungeKutta6.h 184 2007-06-04 11:26:12Z elferdo $
 #ifndef RUNGEKUTTA6_H_
 #define RUNGEKUTTA6_H_
 
-/**
- * @todo Fix include paths
- */
+#include "ExplicitRungeKutta.h"
 
-#include <algorithm>
-#include "SystemConcept.h"
-
-class RungeKutta6
+struct RungeKutta6Tableau
 {
-public:
-	template <typename TSystem>
-	static void step(TSystem &s, typename TSystem::precission_t h, typename TSystem::precission_t * const variables, typename TSystem::precission_t * const parameters)
-	{
-		using namespace std;
-		
-		static_assert(TSystem::n_variables > 0, "TSystem must have at least one variable");	
-		
-		typedef typename TSystem::precission_t vars_type[TSystem::n_variables];
-		
-		vars_type apoyo, retorno;
-		vars_type k[6];
-		
-		const int dim = TSystem::n_variables;
-				
-		int j;
-
-		s.eval(variables, parameters, retorno);
-
-		for (int i = 0; i < dim; ++i) {
-			k[0][i] = retorno[i] * h;
-		}
-
-		for (int i = 0; i < dim; ++i) {
-			apoyo[i] = variables[i] + k[0][i] * .2;
-		}
-		
-		s.eval(apoyo, parameters, retorno);
-
-		for (int i = 0; i < dim; ++i) {
-			k[1][i] = retorno[i] * h;
-		}
-		
-		for(j = 0; j < dim; ++j){
-			apoyo[j] = variables[j] + k[0][j] * .075 + k[1][j] * 0.225;
-		}
-		
-		s.eval(apoyo, parameters, retorno);
-
-		for (int i = 0; i < dim; ++i) {
-			k[2][i] = retorno[i] * h;
-		}
-				
-		for(j = 0; j < dim; ++j){
-			apoyo[j] = variables[j] + k[0][j] * .3 - k[1][j] * 0.9 + k[2][j] * 1.2;
-		}
-		
-		s.eval(apoyo, parameters, retorno);
-		
-		for (int i = 0; i < dim; ++i) {
-			k[3][i] = retorno[i] * h;
-		}
-				
-		for(j = 0; j < dim; ++j){
-			apoyo[j] = variables[j] + k[0][j] * 0.075 + k[1][j] * 0.675 - k[2][j] * 0.6 + k[3][j] * 0.75;
-		}
-		
-		s.eval(apoyo, parameters, retorno);
-
-		for (int i = 0; i < dim; ++i) {
-			k[4][i] = retorno[i] * h;
-		}
-				
-		for(j = 0; j < dim; ++j){
-			apoyo[j] = variables[j] + k[0][j] * 0.660493827160493 + k[1][j] * 2.5 - k[2][j] * 5.185185185185185 + k[3][j] * 3.888888888888889 - k[4][j] * 0.864197530864197;
-		}
-		
-		s.eval(apoyo, parameters, retorno);
+	static constexpr int stages = 6;
+
+	static constexpr double a[stages][stages] = {
+		{},
+		{.2},
+		{.075, 0.225},
+		{.3, -0.9, 1.2},
+		{0.075, 0.675, -0.6, 0.75},
+		{0.660493827160493, 2.5, -5.185185185185185, 3.888888888888889, -0.864197530864197}
+	};
+
+	static constexpr double b[stages] = {0.098765432098765, 0, 0.396825396825396,
+		0.231481481481481, 0.308641975308641, -0.035714285714285};
+};
 
-		for (int i = 0; i < dim; ++i) {
-			k[5][i] = retorno[i] * h;
-		}
-		
-		for(j = 0; j < dim; ++j){
-			variables[j] += k[0][j] * 0.098765432098765 + k[2][j] * 0.396825396825396 + k[3][j] * 0.231481481481481 + k[4][j] * 0.308641975308641 - k[5][j] * 0.035714285714285;
-		}
-	}
+class RungeKutta6 : public ExplicitRungeKutta<RungeKutta6Tableau>
+{
 };
 
 /**
@@ -128,12 +63,11 @@ public:
  * 
  * @brief Implementation of the 6th order Runge-Kutta integration method.
  * 
- * @fn void RungeKutta6::step(double const &t, double const &h, TSystem &s, typename TSystem::variables_list_type &variables, typename TSystem::variables_list_type &increments)
- * @param t Simulation time
- * @param h Increment of simulation time
+ * @fn void RungeKutta6::step(TSystem &s, precission_t h, precission_t * const variables, precission_t * const parameters)
  * @param s System to be simulated
- * @param[in] variables Array consisting of the variables of the system
- * @param[out] increments Array where the calculated increments will be stored
+ * @param h Increment of simulation time
+ * @param[in,out] variables Array consisting of the variables of the system
+ * @param parameters Array consisting of the parameters of the system
  * 
  * This method implements the following algorithm in "parallel" for all
  * variables of the system:
@@ -0,0 +1,85 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef RUSHLARSEN_H_
+#define RUSHLARSEN_H_
+
+#include <cmath>
+#include "SystemConcept.h"
+#include "GatedModelConcept.h"
+
+/**
+ * @class RushLarsen
+ *
+ * @brief Exponential integrator for conductance models (Rush and Larsen, 1978).
+ *
+ * Gating variables are advanced with the exact solution of their linear
+ * equation for frozen voltage,
+ * @f$x' = x_\infty + (x - x_\infty) e^{-h/\tau}@f$,
+ * which is stable for any h. The remaining variables use explicit Euler.
+ * The system must satisfy GatedModelConcept.
+ */
+class RushLarsen
+{
+public:
+	template <typename TSystem>
+	static void step(TSystem &s,
+		typename TSystem::precission_t h,
+		typename TSystem::precission_t * const variables,
+		typename TSystem::precission_t * const parameters)
+	{
+		using namespace std;
+
+		static_assert(SystemConcept<TSystem>, "TSystem must satisfy SystemConcept");
+		static_assert(GatedModelConcept<TSystem>, "TSystem must satisfy GatedModelConcept");
+
+		typedef typename TSystem::precission_t vars_type[TSystem::n_variables];
+
+		vars_type incs, inf, tau;
+
+		const int dim = TSystem::n_variables;
+
+		s.eval(variables, parameters, incs);
+		s.gate_kinetics(variables, parameters, inf, tau);
+
+		for (int i = 0; i < dim; ++i) {
+			if (TSystem::is_gate(i)) {
+				variables[i] = inf[i] + (variables[i] - inf[i]) * exp(-h / tau[i]);
+			} else {
+				variables[i] += h * incs[i];
+			}
+		}
+	}
+};
+
+#endif /*RUSHLARSEN_H_*/
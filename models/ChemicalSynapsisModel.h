@@ -98,6 +98,11 @@ class ChemicalSynapsisModel {
             precission* const incs) const {
       incs[mslow] = ((params[k1] * (1 - vars[mslow])) / (1 + exp(params[sslow] * (params[Vslow] - params[v_pre])))) - params[k2] * vars[mslow];
   }
+
+  void jacobian([[maybe_unused]] const precission* const vars, const precission* const params,
+                precission* const jac) const {
+      jac[mslow * n_variables + mslow] = -params[k1] / (1 + exp(params[sslow] * (params[Vslow] - params[v_pre]))) - params[k2];
+  }
 };
 
 #endif /*CHEMICAL_SYNAPSIS_MODEL_H_*/
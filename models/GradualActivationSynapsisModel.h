@@ -39,10 +39,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <type_traits>
 #endif  //__AVR_ARCH__
 
+#include <cmath>
+
+#include "NeunMath.h"
+
 /**
  * @brief Implements a synapsis based on (Destexhe et al. 1994)
+ *
+ * Math selects the implementation of exp, see NeunMath.h
  */
-template <typename precission = double>
+template <typename precission = double, typename Math = neun::math::exact>
 class GradualActivationSynapsisModel {
 #ifndef __AVR_ARCH__
   static_assert(std::is_floating_point<precission>::value);
@@ -65,13 +71,23 @@ class GradualActivationSynapsisModel {
  public:
   GradualActivationSynapsisModel() {}
 
+  void on_parameters_changed(const precission* const params) {
+    m_inv_tau_syn = 1 / params[tau_syn];
+    m_inv_dec_slope = 1 / params[dec_slope];
+  }
+
   void eval(const precission* const vars, const precission* const params,
             precission* const incs) const {
     
-      precission r_inf = 1 / (1 + exp( (params[v_r] - params[v_pre]) / params[dec_slope]));
-      incs[r] = (r_inf - vars[r]) / tau_syn;
-      incs[s] = (vars[r] - vars[s]) / tau_syn;
+      precission r_inf = 1 / (1 + Math::exp( (params[v_r] - params[v_pre]) * m_inv_dec_slope));
+      incs[r] = (r_inf - vars[r]) * m_inv_tau_syn;
+      incs[s] = (vars[r] - vars[s]) * m_inv_tau_syn;
+      incs[i] = 0;
   }
+
+ private:
+  precission m_inv_tau_syn = 1;
+  precission m_inv_dec_slope = 1;
 };
 
 #endif /*GRADUAL_ACTIVATION_SYNAPSIS_MODEL_H_*/
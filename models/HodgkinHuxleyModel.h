@@ -38,6 +38,7 @@ $Id: HodgkinHuxleyModel.h 184 2007-06-04 11:26:12Z elferdo $
 
 #include <cmath>
 #include "NeuronBase.h"
+#include "NeunMath.h"
 
 /**
  * (Hodgkin and Huxley, 1952)
@@ -48,9 +49,11 @@ $Id: HodgkinHuxleyModel.h 184 2007-06-04 11:26:12Z elferdo $
  * gna = 120 * 7.854e-3
  * gk = 36 * 7.854e-3
  * gl = 0.3 * 7.854e-3
+ *
+ * Math selects the implementation of exp, see NeunMath.h
  */
 
-template <typename Precission>
+template <typename Precission, typename Math = neun::math::exact>
 class HodgkinHuxleyModel : public NeuronBase<Precission>
 {
 public:
@@ -63,32 +66,32 @@ protected:
 
 	Precission alpha_h(Precission v) const
 	{
-		return 0.07 * exp((-v - 65) / 20);
+		return 0.07 * Math::exp((-v - 65) / 20);
 	}
 
 	Precission beta_h(Precission v) const
 	{
-		return 1 / (exp((-v - 35) / 10) + 1);
+		return 1 / (Math::exp((-v - 35) / 10) + 1);
 	}
 
 	Precission alpha_m(Precission v) const
 	{
-		return (0.1 * (-v - 40))/(exp((-v - 40) / 10) - 1);
+		return (0.1 * (-v - 40))/(Math::exp((-v - 40) / 10) - 1);
 	}
 
 	Precission beta_m(Precission v) const
 	{
-		return 4 * exp((-v - 65) / 18);
+		return 4 * Math::exp((-v - 65) / 18);
 	}
 
 	Precission alpha_n(Precission v) const
 	{
-		return (0.01 * (-v - 55)) / (exp((-v - 55) / 10) - 1);
+		return (0.01 * (-v - 55)) / (Math::exp((-v - 55) / 10) - 1);
 	}
 
 	Precission beta_n(Precission v) const
 	{
-		return 0.125 * exp((-v - 65) / 80);
+		return 0.125 * Math::exp((-v - 65) / 80);
 	}
 
 public:
@@ -102,7 +105,35 @@ public:
 		incs[m] = alpha_m(vars[v]) * (1 - vars[m]) - beta_m(vars[v]) * vars[m];
 		incs[h] = alpha_h(vars[v]) * (1 - vars[h]) - beta_h(vars[v]) * vars[h];
 		incs[n] = alpha_n(vars[v]) * (1 - vars[n]) - beta_n(vars[v]) * vars[n];
-		incs[v] = (SYNAPTIC_INPUT - params[gl] * (vars[v] - params[vl]) - params[gna] * pow(vars[m], 3) * vars[h] * (vars[v] - params[vna]) - params[gk] * pow(vars[n], 4) * (vars[v] - params[vk])) / params[cm];
+		incs[v] = (SYNAPTIC_INPUT - params[gl] * (vars[v] - params[vl]) - params[gna] * neun::math::ipow<3>(vars[m]) * vars[h] * (vars[v] - params[vna]) - params[gk] * neun::math::ipow<4>(vars[n]) * (vars[v] - params[vk])) / params[cm];
+	}
+
+	static constexpr bool is_gate(int var)
+	{
+		return var == h || var == m || var == n;
+	}
+
+	void gate_kinetics(const Precission * const vars,
+		Precission * const params,
+		Precission * const inf,
+		Precission * const tau) const
+	{
+		Precission a, b;
+
+		a = alpha_m(vars[v]);
+		b = beta_m(vars[v]);
+		inf[m] = a / (a + b);
+		tau[m] = 1 / (a + b);
+
+		a = alpha_h(vars[v]);
+		b = beta_h(vars[v]);
+		inf[h] = a / (a + b);
+		tau[h] = 1 / (a + b);
+
+		a = alpha_n(vars[v]);
+		b = beta_n(vars[v]);
+		inf[n] = a / (a + b);
+		tau[n] = 1 / (a + b);
 	}
 };
 
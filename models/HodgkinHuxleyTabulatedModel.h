@@ -0,0 +1,153 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef HODGKINHUXLEYTABULATEDMODEL_H_
+#define HODGKINHUXLEYTABULATEDMODEL_H_
+
+#include <cmath>
+#include <memory>
+#include "HodgkinHuxleyModel.h"
+#include "RateTable.h"
+
+/**
+ * HodgkinHuxleyModel with the six rate functions read from a table instead
+ * of evaluated, which removes every exp from eval.
+ *
+ * Rates are sampled once on a grid shared by all the neurons (rates do not
+ * depend on the parameters) and linearly interpolated. Voltages outside the
+ * grid fall back to the exact functions. The default grid covers
+ * [-100, 60] mV every 0.05 mV; set_grid changes it for the neurons built
+ * afterwards, and max_rate_error reports the interpolation error of the
+ * table a neuron uses.
+ */
+template <typename Precission>
+class HodgkinHuxleyTabulatedModel : public HodgkinHuxleyModel<Precission>
+{
+	typedef HodgkinHuxleyModel<Precission> Base;
+
+	enum rate {am, bm, ah, bh, an, bn, n_rates};
+
+public:
+	typedef Precission precission_t;
+	typedef RateTable<Precission, n_rates> table_type;
+
+private:
+	std::shared_ptr<const table_type> m_table;
+
+	static std::shared_ptr<const table_type> &shared_table()
+	{
+		static std::shared_ptr<const table_type> table =
+			std::make_shared<const table_type>(-100, 60, 0.05, exact_rates);
+
+		return table;
+	}
+
+	/* Same functions as HodgkinHuxleyModel, written with expm1 so they are accurate near their removable singularities */
+	static void exact_rates(Precission v, Precission * const out)
+	{
+		const Precission um = (-v - 40) / 10;
+		const Precission un = (-v - 55) / 10;
+
+		out[am] = um == 0 ? 1 : um / std::expm1(um);
+		out[bm] = 4 * std::exp((-v - 65) / 18);
+		out[ah] = 0.07 * std::exp((-v - 65) / 20);
+		out[bh] = 1 / (std::exp((-v - 35) / 10) + 1);
+		out[an] = un == 0 ? Precission(0.1) : Precission(0.1) * un / std::expm1(un);
+		out[bn] = 0.125 * std::exp((-v - 65) / 80);
+	}
+
+	void rates(Precission v, Precission * const out) const
+	{
+		if (m_table->contains(v)) {
+			m_table->lookup(v, out);
+		} else {
+			exact_rates(v, out);
+		}
+	}
+
+public:
+	HodgkinHuxleyTabulatedModel() : m_table(shared_table()) {}
+
+	/**
+	 * Builds a new table for the neurons constructed from now on. Neurons
+	 * already built keep the table they had. Not thread safe.
+	 */
+	static void set_grid(Precission v_min, Precission v_max, Precission dv)
+	{
+		shared_table() = std::make_shared<const table_type>(v_min, v_max, dv, exact_rates);
+	}
+
+	/* Largest absolute error of the interpolated rates, in 1/ms */
+	Precission max_rate_error() const
+	{
+		return m_table->max_error();
+	}
+
+	void eval(const Precission * const vars,
+		Precission * const params,
+		Precission * const incs) const
+	{
+		Precission r[n_rates];
+
+		rates(vars[Base::v], r);
+
+		const Precission m = vars[Base::m], h = vars[Base::h], n = vars[Base::n];
+		const Precission n2 = n * n;
+
+		incs[Base::m] = r[am] * (1 - m) - r[bm] * m;
+		incs[Base::h] = r[ah] * (1 - h) - r[bh] * h;
+		incs[Base::n] = r[an] * (1 - n) - r[bn] * n;
+		incs[Base::v] = (SYNAPTIC_INPUT - params[Base::gl] * (vars[Base::v] - params[Base::vl]) - params[Base::gna] * m * m * m * h * (vars[Base::v] - params[Base::vna]) - params[Base::gk] * n2 * n2 * (vars[Base::v] - params[Base::vk])) / params[Base::cm];
+	}
+
+	void gate_kinetics(const Precission * const vars,
+		Precission * const params,
+		Precission * const inf,
+		Precission * const tau) const
+	{
+		Precission r[n_rates];
+
+		rates(vars[Base::v], r);
+
+		tau[Base::m] = 1 / (r[am] + r[bm]);
+		inf[Base::m] = r[am] * tau[Base::m];
+
+		tau[Base::h] = 1 / (r[ah] + r[bh]);
+		inf[Base::h] = r[ah] * tau[Base::h];
+
+		tau[Base::n] = 1 / (r[an] + r[bn]);
+		inf[Base::n] = r[an] * tau[Base::n];
+	}
+};
+
+#endif /*HODGKINHUXLEYTABULATEDMODEL_H_*/
@@ -69,6 +69,14 @@ class IzhikevichModel : public NeuronBase<Precission> {
       this->set(u, this->get(u) + this->get(d));
     }
   }
+
+  /* The same reset on variables held elsewhere, see NeuronPopulation */
+  void post_step(Precission h, Precission *const vars, Precission *const params) {
+    if (vars[v] >= params[threshold]) {
+      vars[v] = params[c];
+      vars[u] = vars[u] + params[d];
+    }
+  }
 };
 
 #endif /*IZHIKEVICHMODEL_H_*/
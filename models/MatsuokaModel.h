@@ -55,11 +55,21 @@ class MatsuokaModel : public NeuronBase<Precission> {
   enum variable { x, v, n_variables };
   enum parameter { beta, t1, t2, c, n_parameters };
 
+ private:
+  Precission m_inv_t1 = 1;
+  Precission m_inv_t2 = 1;
+
+ public:
+  void on_parameters_changed(const Precission* const params) {
+    m_inv_t1 = 1 / params[t1];
+    m_inv_t2 = 1 / params[t2];
+  }
+
   void eval(const Precission* const vars, Precission* const params,
             Precission* const incs) const {
-    incs[x] = (-vars[x] - params[beta] * vars[v] + SYNAPTIC_INPUT + params[c]) /
-              params[t1];
-    incs[v] = (-vars[v] + ((vars[x] > 0) ? vars[x] : 0)) / params[t2];
+    incs[x] = (-vars[x] - params[beta] * vars[v] + SYNAPTIC_INPUT + params[c]) *
+              m_inv_t1;
+    incs[v] = (-vars[v] + ((vars[x] > 0) ? vars[x] : 0)) * m_inv_t2;
   }
 };
 
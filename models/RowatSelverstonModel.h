@@ -38,6 +38,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <cmath>
 #include <type_traits>
 
+#include "NeuronBase.h"
+#include "NeunMath.h"
+
 /** (Rowat and Selverston, 1997)
  * tm = 1
  * sf = 2
@@ -45,9 +48,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * ss = 1
  * af = 1
  * es = 1
+ *
+ * Math selects the implementation of tanh, see NeunMath.h
  */
-template <typename Precission>
-class RowatSelverstonModel {
+template <typename Precission, typename Math = neun::math::exact>
+class RowatSelverstonModel : public NeuronBase<Precission> {
   static_assert(std::is_floating_point<Precission>::value);
 
  public:
@@ -56,15 +61,24 @@ class RowatSelverstonModel {
   enum variable { v = 0, q = 1, n_variables };
   enum parameter { tm, sf, ts, ss, af, es, n_parameters };
 
+ private:
+  Precission m_sf_af = 2;
+  Precission m_inv_tm = 1;
+  Precission m_inv_ts = 0.5;
+
  public:
-  void eval(const Precission *const vars, Precission *const incs) const {
-    incs[v] = -(vars[v] -
-                m_parameters[af] *
-                    tanh((m_parameters[sf] / m_parameters[af]) * vars[v]) +
-                vars[q] - SYNAPTIC_INPUT) /
-              m_parameters[tm];
-    incs[q] = (-vars[q] + m_parameters[ss] * (vars[v] - m_parameters[es])) /
-              m_parameters[ts];
+  void on_parameters_changed(const Precission *const params) {
+    m_sf_af = params[sf] / params[af];
+    m_inv_tm = 1 / params[tm];
+    m_inv_ts = 1 / params[ts];
+  }
+
+  void eval(const Precission *const vars, Precission *const params,
+            Precission *const incs) const {
+    incs[v] = -(vars[v] - params[af] * Math::tanh(m_sf_af * vars[v]) + vars[q] -
+                SYNAPTIC_INPUT) *
+              m_inv_tm;
+    incs[q] = (-vars[q] + params[ss] * (vars[v] - params[es])) * m_inv_ts;
   }
 };
 
@@ -71,6 +71,9 @@ public:
 					Inat, Inap, Ia, Id, Ilva, Ihva,
 					n_parameters};
 
+	/* eval writes dv and the currents, see OutputParametersConcept */
+	static constexpr int first_output = dv;
+
 protected:
 
 	Precission x_inf(Precission v, Precission vh, Precission vs) const
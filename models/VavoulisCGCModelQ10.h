@@ -37,7 +37,9 @@ $Id: VavoulisCGCModelQ10.h 184 2007-06-04 11:26:12Z elferdo $
 
 #include <cmath>
 #include "NeuronBase.h"
+#include "NeunMath.h"
 #include <string>
+#include <vector>
 
 /**
  * (Hodgkin and Huxley, 1952)
@@ -48,9 +50,11 @@ $Id: VavoulisCGCModelQ10.h 184 2007-06-04 11:26:12Z elferdo $
  * gna = 120 * 7.854e-3
  * gk = 36 * 7.854e-3
  * gl = 0.3 * 7.854e-3
+ *
+ * Math selects the implementation of exp and pow, see NeunMath.h
  */
 
-template <typename Precission>
+template <typename Precission, typename Math = neun::math::exact>
 class VavoulisCGCModelQ10 : public NeuronBase<Precission>
 {
 public:
@@ -74,6 +78,9 @@ public:
 					Inat, Inap, Ia, Id, Ilva, Ihva,
 					n_parameters};
 
+	/* eval writes dv and the currents, see OutputParametersConcept */
+	static constexpr int first_output = dv;
+
 	static constexpr std::vector<std::string> VarNames()
 	{
 		return std::vector<std::string> {"v", "h", "r", "a", "b", "n", "e", "f"};
@@ -102,16 +109,19 @@ protected:
 
 	Precission x_inf(Precission v, Precission vh, Precission vs) const
 	{
-		return 1 / (1 + exp((vh - v) / vs));
+		return 1 / (1 + Math::exp((vh - v) / vs));
+	}
+
+	Precission tau_x(Precission xinf, Precission v, Precission vh, Precission vs, Precission tau0, Precission delta) const
+	{
+		return tau0 * Math::exp(delta * (vh - v) / vs) * xinf;
 	}
 
 	Precission incr_x(Precission phi_q10, Precission x, Precission v, Precission vh, Precission vs, Precission tau0, Precission delta) const
 	{
 		Precission xinf = x_inf(v,vh,vs);
 
-		Precission taux = tau0 * exp(delta * (vh - v) / vs) * xinf;
-
-		return phi_q10 * (xinf - x) / taux;
+		return phi_q10 * (xinf - x) / tau_x(xinf, v, vh, vs, tau0, delta);
 	}
 
 
@@ -119,20 +129,20 @@ protected:
 	Precission inat(Precission v, Precission h, Precission gnat, Precission vna,
 					 Precission vh_m, Precission vs_m) const {
 		Precission minf = x_inf(v, vh_m, vs_m);
-		return gnat * pow(minf,3) * h * (v - vna);
+		return gnat * neun::math::ipow<3>(minf) * h * (v - vna);
 	}
 
 	Precission inap(Precission v, Precission r, Precission gnap, Precission vna) const {
-		return gnap * pow(r,3) * (v - vna);
+		return gnap * neun::math::ipow<3>(r) * (v - vna);
 	}
 
 	//Potassium
 	Precission ia(Precission v, Precission a, Precission b, Precission ga, Precission vk) const {
-		return ga * pow(a,4) * b * (v - vk);
+		return ga * neun::math::ipow<4>(a) * b * (v - vk);
 	}
 
 	Precission id(Precission v, Precission n, Precission gd, Precission vk) const {
-		return gd * pow(n,4) * (v - vk);
+		return gd * neun::math::ipow<4>(n) * (v - vk);
 	}
 
 	//Calcium
@@ -141,17 +151,17 @@ protected:
 
 		Precission cinf = x_inf(v,vh_c,vs_c);
 		Precission dinf = x_inf(v,vh_d,vs_d);
-		return glva * pow(cinf,3) * dinf * (v - vca);
+		return glva * neun::math::ipow<3>(cinf) * dinf * (v - vca);
 	}
 
 	Precission ihva(Precission v, Precission e, Precission f, Precission ghva, Precission vca) const {
-		return ghva * pow(e,3) * f *(v - vca);
+		return ghva * neun::math::ipow<3>(e) * f *(v - vca);
 	}
 
 	Precission g_q10(Precission q10, Precission g, Precission diff_T) const
 	{
 		if (q10 > 0)
-			return g * pow(q10,diff_T/10);
+			return g * Math::pow(q10,diff_T/10);
 		else
 			return 1 * g;
 	}
@@ -159,7 +169,7 @@ protected:
 	Precission phi_q10(Precission q10, Precission diff_T) const
 	{
 		if (q10 > 0)
-			return pow(q10,diff_T/10);
+			return Math::pow(q10,diff_T/10);
 		else
 			return 1;
 	}
@@ -173,11 +183,6 @@ protected:
 
 public:
 
-  VavoulisCGCModelQ10(ConstructorArgs const &args)
-  {
-    std::copy(args.params, args.params + n_parameters, m_parameters);
-  }
-
 	void eval(const Precission * const vars, Precission * const params, Precission * const incs) const
 	{
 		incs[h]= params[t_scale] * incr_x(phi_q10(params[Q10_h], params[diff_T]),
@@ -235,6 +240,28 @@ public:
 
 	}
 
+	static constexpr bool is_gate(int var)
+	{
+		return var != v;
+	}
+
+	void gate_kinetics(const Precission * const vars, Precission * const params,
+		Precission * const inf, Precission * const tau) const
+	{
+		const int gates[] = {h, r, a, b, n, e, f};
+		const int first[] = {vh_h, vh_r, vh_a, vh_b, vh_n, vh_e, vh_f};
+
+		for (int i = 0; i < 7; ++i) {
+			/* Each gate has its parameters laid out as vh, vs, tau0, delta, Q10 */
+			const Precission * const p = params + first[i];
+			const int x = gates[i];
+
+			inf[x] = x_inf(vars[v], p[0], p[1]);
+			tau[x] = tau_x(inf[x], vars[v], p[0], p[1], p[2], p[3])
+				/ (params[t_scale] * phi_q10(p[4], params[diff_T]));
+		}
+	}
+
 };
 
 #endif /*VAVOULISCGCMODELQ10_H_*/
@@ -0,0 +1,168 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef VAVOULISCGCMODELQ10CACHED_H_
+#define VAVOULISCGCMODELQ10CACHED_H_
+
+#include <cmath>
+#include "VavoulisCGCModelQ10.h"
+
+/**
+ * VavoulisCGCModelQ10 with the temperature factors computed once per
+ * parameter set instead of on every eval.
+ *
+ * phi_q10, g_q10 and c_q10 only depend on the parameters, so they are
+ * computed in on_parameters_changed (see ParameterHookConcept). What is left
+ * per eval is the state dependent math: one exp per gate for x_inf, another
+ * for its time constant, and integer powers written as products.
+ *
+ * Unlike VavoulisCGCModelQ10, eval does not write dv and the currents into
+ * the parameters, which keep whatever value they are given, so systems can
+ * share their parameters (see SharedParametersSystemWrapper).
+ */
+template <typename Precission, typename Math = neun::math::exact>
+class VavoulisCGCModelQ10Cached : public VavoulisCGCModelQ10<Precission, Math>
+{
+	typedef VavoulisCGCModelQ10<Precission, Math> Base;
+
+public:
+	typedef Precission precission_t;
+
+	/* No outputs, see OutputParametersConcept */
+	static constexpr int first_output = Base::n_parameters;
+
+private:
+	static constexpr int n_gates = 7;
+
+	static constexpr int gates[n_gates] = {Base::h, Base::r, Base::a, Base::b, Base::n, Base::e, Base::f};
+
+	/* Each gate has its parameters laid out as vh, vs, tau0, delta, Q10 */
+	static constexpr int first[n_gates] = {Base::vh_h, Base::vh_r, Base::vh_a, Base::vh_b, Base::vh_n, Base::vh_e, Base::vh_f};
+
+	struct factors
+	{
+		/* t_scale * phi_q10 / tau0 of each gate */
+		Precission rate[n_gates];
+		Precission inv_vs[n_gates];
+
+		Precission gnat, gnap, ga, gd, glva, ghva;
+
+		/* t_scale / c_q10 */
+		Precission inv_c;
+	};
+
+	factors m_factors;
+
+public:
+	void on_parameters_changed(const Precission * const params)
+	{
+		factors &c = m_factors;
+
+		const Precission diff_T = params[Base::diff_T];
+
+		for (int i = 0; i < n_gates; ++i) {
+			Precission const * const p = params + first[i];
+
+			c.rate[i] = params[Base::t_scale] * this->phi_q10(p[4], diff_T) / p[2];
+			c.inv_vs[i] = 1 / p[1];
+		}
+
+		c.gnat = this->g_q10(params[Base::Q10_Gnat], params[Base::Gnat], diff_T);
+		c.gnap = this->g_q10(params[Base::Q10_Gnap], params[Base::Gnap], diff_T);
+		c.ga = this->g_q10(params[Base::Q10_Ga], params[Base::Ga], diff_T);
+		c.gd = this->g_q10(params[Base::Q10_Gd], params[Base::Gd], diff_T);
+		c.glva = this->g_q10(params[Base::Q10_Glva], params[Base::Glva], diff_T);
+		c.ghva = this->g_q10(params[Base::Q10_Ghva], params[Base::Ghva], diff_T);
+
+		c.inv_c = params[Base::t_scale] / this->c_q10(params[Base::cm], params[Base::gamma_T], diff_T);
+	}
+
+	void eval(const Precission * const vars, Precission * const params, Precission * const incs) const
+	{
+		factors const &c = m_factors;
+
+		const Precission v = vars[Base::v];
+
+		for (int i = 0; i < n_gates; ++i) {
+			Precission const * const p = params + first[i];
+			const int x = gates[i];
+
+			/* xinf = 1 / (1 + E) and tau = tau0 * exp(delta * u) * xinf */
+			const Precission u = (p[0] - v) * c.inv_vs[i];
+			const Precission E = Math::exp(u);
+			const Precission xinf = 1 / (1 + E);
+
+			incs[x] = c.rate[i] * (xinf - vars[x]) * (1 + E) * Math::exp(-p[3] * u);
+		}
+
+		const Precission minf = this->x_inf(v, params[Base::Vh_m], params[Base::Vs_m]);
+		const Precission cinf = this->x_inf(v, params[Base::Vh_c], params[Base::Vs_c]);
+		const Precission dinf = this->x_inf(v, params[Base::Vh_d], params[Base::Vs_d]);
+
+		const Precission r = vars[Base::r], a = vars[Base::a], n = vars[Base::n], e = vars[Base::e];
+		const Precission a2 = a * a, n2 = n * n;
+
+		const Precission inat = c.gnat * minf * minf * minf * vars[Base::h] * (v - params[Base::vna]);
+		const Precission inap = c.gnap * r * r * r * (v - params[Base::vna]);
+		const Precission ia = c.ga * a2 * a2 * vars[Base::b] * (v - params[Base::vk]);
+		const Precission id = c.gd * n2 * n2 * (v - params[Base::vk]);
+		const Precission ilva = c.glva * cinf * cinf * cinf * dinf * (v - params[Base::vca]);
+		const Precission ihva = c.ghva * e * e * e * vars[Base::f] * (v - params[Base::vca]);
+
+		incs[Base::v] = (SYNAPTIC_INPUT
+					- inat - inap
+					- ia - id
+					- ilva - ihva)
+					* c.inv_c;
+	}
+
+	void gate_kinetics(const Precission * const vars, Precission * const params,
+		Precission * const inf, Precission * const tau) const
+	{
+		factors const &c = m_factors;
+
+		const Precission v = vars[Base::v];
+
+		for (int i = 0; i < n_gates; ++i) {
+			Precission const * const p = params + first[i];
+			const int x = gates[i];
+
+			const Precission u = (p[0] - v) * c.inv_vs[i];
+
+			inf[x] = 1 / (1 + Math::exp(u));
+			tau[x] = Math::exp(p[3] * u) * inf[x] / c.rate[i];
+		}
+	}
+};
+
+#endif /*VAVOULISCGCMODELQ10CACHED_H_*/
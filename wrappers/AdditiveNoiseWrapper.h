@@ -0,0 +1,89 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef ADDITIVENOISEWRAPPER_H_
+#define ADDITIVENOISEWRAPPER_H_
+
+#include "SystemConcept.h"
+
+/**
+ * \brief Adds constant (additive) noise to the variables of a system, so
+ * that it can be integrated with EulerMaruyama, Milstein or StochasticHeun.
+ *
+ * Noise amplitudes start at zero and are set with set_noise. For a neuron,
+ * a current noise of standard deviation sigma is sigma / cm on v.
+ *
+ * \param System The system<model> class to extend.
+ */
+template <typename System>
+requires SystemConcept<System>
+class AdditiveNoiseWrapper : public System
+{
+	typename System::precission_t m_noise[System::n_variables];
+
+public:
+	typedef typename System::precission_t precission_t;
+	typedef typename System::variable variable;
+	typedef typename System::parameter parameter;
+	typedef typename System::ConstructorArgs ConstructorArgs;
+
+	AdditiveNoiseWrapper(ConstructorArgs const &args) : System(args)
+	{
+		for (int i = 0; i < System::n_variables; i++) {
+			m_noise[i] = 0;
+		}
+	}
+
+	AdditiveNoiseWrapper(ConstructorArgs &&args) : AdditiveNoiseWrapper(args)
+	{
+	}
+
+	void set_noise(variable var, precission_t value)
+	{
+		m_noise[var] = value;
+	}
+
+	precission_t get_noise(variable var) const
+	{
+		return m_noise[var];
+	}
+
+	void diffusion(const precission_t * const vars, precission_t * const params, precission_t * const g) const
+	{
+		for (int i = 0; i < System::n_variables; i++) {
+			g[i] = m_noise[i];
+		}
+	}
+};
+
+#endif /*ADDITIVENOISEWRAPPER_H_*/
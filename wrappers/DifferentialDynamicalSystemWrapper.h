@@ -40,6 +40,8 @@ $Id$
 
 #include "DynamicalSystemConcept.h"
 #include "DynamicalSystemWrapper.h"
+#include "IntegratorConcept.h"
+#include "IntegratorState.h"
 
 /**
  * \brief Adds common code to a model class.
@@ -56,8 +58,10 @@ class DifferentialDynamicalSystemWrapper : public DynamicalSystemWrapper<Wrapee>
 
   static_assert(DynamicalSystemConcept<Wrapee>, "Wrapee must satisfy DynamicalSystemConcept");
 
-  static_assert(IntegratorConcept<Integrator, Wrapee>,
-                "Integrator must satisfy IntegratorConcept");
+  static_assert(AnyIntegratorConcept<Integrator, Wrapee>,
+                "Integrator must satisfy IntegratorConcept or StatefulIntegratorConcept");
+
+  [[no_unique_address]] typename IntegratorState<Integrator, Wrapee>::type m_integrator_state;
 
  public:
   typedef typename Wrapee::precission_t precission_t;
@@ -69,7 +73,25 @@ class DifferentialDynamicalSystemWrapper : public DynamicalSystemWrapper<Wrapee>
       : DynamicalSystemWrapper<Wrapee>(args) {}
 
   void step(precission_t h) {
-    Integrator::step(*this, h, Wrapee::m_variables, Wrapee::m_parameters);
+    integrator_step<Integrator, Wrapee>(*this, h, Wrapee::m_variables,
+                                        Wrapee::m_parameters, m_integrator_state);
+  }
+
+  typename IntegratorState<Integrator, Wrapee>::type &integrator_state() {
+    return m_integrator_state;
+  }
+
+  void restart_integrator() { m_integrator_state.reset(); }
+
+  /* Changing the state from outside invalidates what the integrator kept */
+  void set(variable var, precission_t value) {
+    DynamicalSystemWrapper<Wrapee>::set(var, value);
+    m_integrator_state.reset();
+  }
+
+  void set(parameter param, precission_t value) {
+    DynamicalSystemWrapper<Wrapee>::set(param, value);
+    m_integrator_state.reset();
   }
 };
 
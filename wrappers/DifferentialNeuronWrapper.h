@@ -36,21 +36,28 @@ $Id$
 #define DIFFERENTIALNEURONWRAPPER_H_
 
 
+#include <iostream>
 #include <type_traits>
 
+#include "Checkpoint.h"
 #include "NeuronConcept.h"
 #include "DynamicalSystemWrapper.h"
 #include "DynamicalSystemConcept.h"
 #include "IntegratorConcept.h"
+#include "IntegratorState.h"
+#include "NeunPrecision.h"
 
 /**
  * \brief Adds common code to a model class.
  * \todo Check concepts
  * \param Wrapee The model class to extend.
  * \param Integrator The integrator class to use
+ * \param Precision How increments are added to the variables, see
+ * neun::precision
  */
 
-template <typename Wrapee, typename Integrator>
+template <typename Wrapee, typename Integrator,
+          typename Precision = neun::precision::native>
 requires NeuronConcept<Wrapee>
 class DifferentialNeuronWrapper : public DynamicalSystemWrapper<Wrapee> {
   static_assert(std::is_floating_point<typename Wrapee::precission_t>::value,
@@ -58,8 +65,11 @@ class DifferentialNeuronWrapper : public DynamicalSystemWrapper<Wrapee> {
 
   static_assert(DynamicalSystemConcept<Wrapee>, "Wrapee must satisfy DynamicalSystemConcept");
 
-  static_assert(IntegratorConcept<Integrator, Wrapee>,
-                "Integrator must satisfy IntegratorConcept");
+  static_assert(AnyIntegratorConcept<Integrator, Wrapee>,
+                "Integrator must satisfy IntegratorConcept or StatefulIntegratorConcept");
+
+  [[no_unique_address]] typename IntegratorState<Integrator, Wrapee>::type m_integrator_state;
+  [[no_unique_address]] typename Precision::template state_type<Wrapee> m_precision_state;
 
  public:
   typedef typename Wrapee::precission_t precission_t;
@@ -71,14 +81,47 @@ class DifferentialNeuronWrapper : public DynamicalSystemWrapper<Wrapee> {
       : DynamicalSystemWrapper<Wrapee>(args) {}
 
   void step(precission_t h) {
-    Integrator::step(*this, h, Wrapee::m_variables, Wrapee::m_parameters);
+    Precision::template step<Integrator, Wrapee>(*this, h, Wrapee::m_variables,
+                                                 Wrapee::m_parameters, m_integrator_state,
+                                                 m_precision_state);
 
     Wrapee::m_synaptic_input = 0;
   }
 
+  typename IntegratorState<Integrator, Wrapee>::type &integrator_state() {
+    return m_integrator_state;
+  }
+
+  void restart_integrator() { m_integrator_state.reset(); }
+
+  /* Changing the state from outside invalidates what the integrator kept */
+  void set(variable var, precission_t value) {
+    DynamicalSystemWrapper<Wrapee>::set(var, value);
+    m_integrator_state.reset();
+    m_precision_state.reset();
+  }
+
+  void set(parameter param, precission_t value) {
+    DynamicalSystemWrapper<Wrapee>::set(param, value);
+    m_integrator_state.reset();
+  }
+
   void add_synaptic_input(precission_t i) { Wrapee::m_synaptic_input += i; }
 
   precission_t get_synaptic_input() const { return Wrapee::m_synaptic_input; }
+
+  /* For a serializable Wrapee, adds what the integrator and the precision policy kept */
+  void save(std::ostream &os) const requires requires(Wrapee const &w) { w.save(os); } {
+    Wrapee::save(os);
+    neun::checkpoint::write_state(os, m_integrator_state);
+    neun::checkpoint::write_state(os, m_precision_state);
+  }
+
+  void load(std::istream &is) requires requires(Wrapee &w) { w.load(is); } {
+    Wrapee::load(is);
+    neun::checkpoint::read_state(is, m_integrator_state);
+    neun::checkpoint::read_state(is, m_precision_state);
+  }
 };
 
 #endif /*DIFFERENTIALNEURONWRAPPER_H_*/
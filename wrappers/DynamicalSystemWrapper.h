@@ -67,7 +67,7 @@ class DynamicalSystemWrapper : public Wrapee {
   }
 
   void set(parameter param, precission_t value) {
-    Wrapee::m_parameters[param] = value;
+    Wrapee::set(param, value);
   }
 };
 
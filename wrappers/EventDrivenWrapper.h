@@ -0,0 +1,122 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef EVENTDRIVENWRAPPER_H_
+#define EVENTDRIVENWRAPPER_H_
+
+#include <cmath>
+
+#include "NeuronConcept.h"
+
+/**
+ * \brief Skips the steps of a neuron while it is at rest.
+ *
+ * A neuron is at rest when, over a step without synaptic input, none of
+ * its variables changed faster than the tolerance (|dx| / h, in units of
+ * the variable per unit of time), i.e. it sits on a fixed point. Testing
+ * the rate rather than the change makes rest independent of the step.
+ * From then on step does nothing (neither integration nor post_step, so no
+ * threshold checks) until synaptic input arrives or a variable is set, at
+ * which point the neuron is stepped again from the state it was left in.
+ * Skipped steps are exact up to the tolerance, so with sparse activity the
+ * cost of a population follows the number of active neurons.
+ *
+ * Neurons with autonomous activity (bursting maps, tonic spiking) never
+ * come to rest and are stepped as usual.
+ *
+ * \param Wrapee The neuron class to extend, e.g. DifferentialNeuronWrapper
+ * or IntegratedSystemWrapper.
+ */
+template <typename Wrapee>
+requires NeuronConcept<Wrapee>
+class EventDrivenWrapper : public Wrapee {
+ public:
+  typedef typename Wrapee::precission_t precission_t;
+  typedef typename Wrapee::variable variable;
+  typedef typename Wrapee::parameter parameter;
+  typedef typename Wrapee::ConstructorArgs ConstructorArgs;
+
+ private:
+  precission_t m_tolerance;
+  bool m_resting;
+  unsigned long m_skipped;
+
+ public:
+  EventDrivenWrapper(ConstructorArgs &args, precission_t tolerance = 1e-7)
+      : Wrapee(args), m_tolerance(tolerance), m_resting(false), m_skipped(0) {}
+
+  EventDrivenWrapper(ConstructorArgs &&args, precission_t tolerance = 1e-7)
+      : EventDrivenWrapper(args, tolerance) {}
+
+  void step(precission_t h) {
+    const bool input = Wrapee::get_synaptic_input() != 0;
+
+    if (m_resting && !input) {
+      ++m_skipped;
+      return;
+    }
+
+    precission_t before[Wrapee::n_variables];
+
+    for (int i = 0; i < Wrapee::n_variables; ++i) {
+      before[i] = Wrapee::m_variables[i];
+    }
+
+    Wrapee::step(h);
+
+    m_resting = !input;
+
+    const precission_t change = m_tolerance * h;
+
+    for (int i = 0; i < Wrapee::n_variables && m_resting; ++i) {
+      m_resting = std::abs(Wrapee::m_variables[i] - before[i]) <= change;
+    }
+  }
+
+  void set(variable var, precission_t value) {
+    Wrapee::set(var, value);
+    m_resting = false;
+  }
+
+  void set(parameter param, precission_t value) {
+    Wrapee::set(param, value);
+    m_resting = false;
+  }
+
+  bool resting() const { return m_resting; }
+
+  /* Steps skipped since construction */
+  unsigned long skipped_steps() const { return m_skipped; }
+};
+
+#endif /*EVENTDRIVENWRAPPER_H_*/
@@ -38,9 +38,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "IntegratableSystemConcept.h"
 #include "IntegratorConcept.h"
+#include "Checkpoint.h"
 #endif  //__AVR_ARCH__
 
+#include <algorithm>
+
 #include "DynamicalSystemWrapper.h"
+#include "IntegratorState.h"
 
 /**
  * \brief Adds common code to a model class.
@@ -50,8 +54,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
 template <typename Wrapee, typename Integrator>
-requires IntegratableSystemConcept<Wrapee> && IntegratorConcept<Integrator, Wrapee>
+requires IntegratableSystemConcept<Wrapee> && AnyIntegratorConcept<Integrator, Wrapee>
 class IntegratedSystemWrapper : public DynamicalSystemWrapper<Wrapee> {
+  [[no_unique_address]] typename IntegratorState<Integrator, Wrapee>::type m_integrator_state;
 
  public:
   typedef typename Wrapee::precission_t precission_t;
@@ -65,22 +70,68 @@ class IntegratedSystemWrapper : public DynamicalSystemWrapper<Wrapee> {
   IntegratedSystemWrapper(ConstructorArgs &args)
       : DynamicalSystemWrapper<Wrapee>(args) {}
 
-  void restart() { Wrapee::restart(); }
+  void restart() {
+    Wrapee::restart();
+    m_integrator_state.reset();
+  }
 
   void step(precission_t h) {
     /* Allow system specific step actions */
 
     Wrapee::pre_step(h);
 
-    Integrator::step(*this, h, Wrapee::m_variables, Wrapee::m_parameters);
+    integrator_step<Integrator, Wrapee>(*this, h, Wrapee::m_variables,
+                                        Wrapee::m_parameters, m_integrator_state);
     Wrapee::m_synaptic_input = 0;
 
-    Wrapee::post_step(h);
+    if constexpr (StatefulIntegratorConcept<Integrator, Wrapee>) {
+      /* Resets done in post_step (e.g. spikes) restart the integrator */
+      precission_t before[Wrapee::n_variables];
+      std::copy(Wrapee::m_variables, Wrapee::m_variables + Wrapee::n_variables, before);
+
+      Wrapee::post_step(h);
+
+      if (!std::equal(before, before + Wrapee::n_variables, Wrapee::m_variables)) {
+        m_integrator_state.reset();
+      }
+    } else {
+      Wrapee::post_step(h);
+    }
   }
 
   void add_synaptic_input(precission_t i) { Wrapee::m_synaptic_input += i; }
 
   precission_t get_synaptic_input() const { return Wrapee::m_synaptic_input; }
+
+  typename IntegratorState<Integrator, Wrapee>::type &integrator_state() {
+    return m_integrator_state;
+  }
+
+  void restart_integrator() { m_integrator_state.reset(); }
+
+  /* Changing the state from outside invalidates what the integrator kept */
+  void set(variable var, precission_t value) {
+    DynamicalSystemWrapper<Wrapee>::set(var, value);
+    m_integrator_state.reset();
+  }
+
+  void set(parameter param, precission_t value) {
+    DynamicalSystemWrapper<Wrapee>::set(param, value);
+    m_integrator_state.reset();
+  }
+
+#ifndef __AVR_ARCH__
+  /* For a serializable Wrapee, adds what the integrator kept */
+  void save(std::ostream &os) const requires requires(Wrapee const &w) { w.save(os); } {
+    Wrapee::save(os);
+    neun::checkpoint::write_state(os, m_integrator_state);
+  }
+
+  void load(std::istream &is) requires requires(Wrapee &w) { w.load(is); } {
+    Wrapee::load(is);
+    neun::checkpoint::read_state(is, m_integrator_state);
+  }
+#endif  //__AVR_ARCH__
 };
 
 #endif /*INTEGRATEDSYSTEMWRAPPER_H_*/
@@ -35,10 +35,20 @@ $Id$
 #ifndef SERIALIZABLEWRAPPER_H_
 #define SERIALIZABLEWRAPPER_H_
 
+#include <cstring>
 #include <iostream>
 
+#include "Checkpoint.h"
+#include "NeuronConcept.h"
 #include "SystemConcept.h"
 
+/**
+ * \brief Saves and restores the state of a system in the binary format of
+ * Checkpoint.h: variables, parameters and, for neurons, the synaptic input
+ * gathered so far. Classes deriving from it with state of their own save
+ * it after calling these.
+ */
+
 template <typename System>
 requires SystemConcept<System>
 class SerializableWrapper : public System{
@@ -60,15 +70,49 @@ public:
 
 	void save(std::ostream &os) const
 	{
+		neun::checkpoint::write_shape<precission_t>(os, System::n_variables, System::n_parameters);
+
 		for(int i = 0; i < System::n_variables; i++){
-			os << System::m_variables[i] << " ";
+			neun::checkpoint::write(os, System::get(static_cast<variable>(i)));
+		}
+
+		for(int i = 0; i < System::n_parameters; i++){
+			neun::checkpoint::write(os, System::get(static_cast<parameter>(i)));
+		}
+
+		if constexpr (NeuronConcept<System>) {
+			neun::checkpoint::write(os, System::get_synaptic_input());
 		}
 	}
 
 	void load(std::istream &is)
 	{
+		neun::checkpoint::expect_shape<precission_t>(is, System::n_variables, System::n_parameters);
+
 		for(int i = 0; i < System::n_variables; i++){
-			is >> System::m_variables[i];
+			precission_t value;
+			neun::checkpoint::read(is, value);
+			System::set(static_cast<variable>(i), value);
+		}
+
+		// Only parameters that differ are set, so that shared parameters
+		// are not copied for nothing, and set() updates what derives from them
+		for(int i = 0; i < System::n_parameters; i++){
+			precission_t value;
+			neun::checkpoint::read(is, value);
+
+			const precission_t current = System::get(static_cast<parameter>(i));
+
+			if (std::memcmp(&value, &current, sizeof(value)) != 0) {
+				System::set(static_cast<parameter>(i), value);
+			}
+		}
+
+		if constexpr (NeuronConcept<System>) {
+			precission_t input;
+			neun::checkpoint::read(is, input);
+			System::reset_synaptic_input();
+			System::add_synaptic_input(input);
 		}
 	}
 };
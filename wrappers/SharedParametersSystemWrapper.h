@@ -0,0 +1,196 @@
+/*************************************************************
+
+Copyright (c) 2026, agent <agent@local>
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+    * Neither the name of the author nor the names of his contributors
+      may be used to endorse or promote products derived from this
+      software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*************************************************************/
+
+#ifndef SHAREDPARAMETERSSYSTEMWRAPPER_H_
+#define SHAREDPARAMETERSSYSTEMWRAPPER_H_
+
+#include "ModelConcept.h"
+#include <algorithm>
+#include <memory>
+
+/**
+ * \brief SystemWrapper whose parameters may be shared by many systems.
+ *
+ * A drop in replacement for SystemWrapper. Systems built from
+ * ConstructorArgs on which share() was called point to the same
+ * parameter block instead of each owning a copy, and so do copies of a
+ * system. Setting a parameter first gives the system its own copy of the
+ * block (copy on write), so a few heterogeneous parameters can still be
+ * overridden per system.
+ *
+ * Models that write outputs into their parameters during eval (e.g. the
+ * currents of VavoulisCGCModelQ10, see OutputParametersConcept) would
+ * write them into the shared block, racing when systems are stepped in
+ * parallel, so they are rejected.
+ *
+ * \param Model The model class to extend.
+ */
+template <typename Model>
+requires ModelConcept<Model>
+class SharedParametersSystemWrapper : public Model
+{
+	static_assert(!OutputParametersConcept<Model>,
+		"Models writing outputs into their parameters cannot share them");
+
+public:
+
+	typedef typename Model::precission_t precission_t;
+	typedef typename Model::variable variable;
+	typedef typename Model::parameter parameter;
+
+	typedef std::shared_ptr<precission_t[]> parameters_ptr;
+
+	struct ConstructorArgs
+	{
+		precission_t params[Model::n_parameters];
+
+		/* When set, systems use this block and ignore params */
+		parameters_ptr shared;
+
+		/* Makes every system built from these args share a copy of params */
+		void share()
+		{
+			shared = make_block(params);
+		}
+	};
+
+protected:
+
+	typename Model::precission_t m_variables[Model::n_variables];
+	typename Model::precission_t *m_parameters;
+
+private:
+
+	parameters_ptr m_block;
+
+	/*
+	 * Whether no other system may use the block. Cleared as soon as the
+	 * block is handed out (copies, parameters()), even by a const system,
+	 * and set again when set() makes a private copy.
+	 */
+	mutable bool m_owned;
+
+public:
+
+	SharedParametersSystemWrapper(ConstructorArgs const &args) : Model()
+	{
+		m_block = args.shared ? args.shared : make_block(args.params);
+		m_owned = !args.shared;
+		m_parameters = m_block.get();
+		parameters_changed();
+	}
+
+	SharedParametersSystemWrapper(SharedParametersSystemWrapper<Model> const &system)
+		: Model(system), m_block(system.m_block), m_owned(false)
+	{
+		system.m_owned = false;
+		m_parameters = m_block.get();
+		std::copy(system.m_variables, system.m_variables + Model::n_variables, m_variables);
+		parameters_changed();
+	}
+
+	SharedParametersSystemWrapper<Model> &operator=(SharedParametersSystemWrapper<Model> const &system)
+	{
+		if (this != &system) {
+			Model::operator=(system);
+			system.m_owned = false;
+			m_block = system.m_block;
+			m_owned = false;
+			m_parameters = m_block.get();
+			std::copy(system.m_variables, system.m_variables + Model::n_variables, m_variables);
+			parameters_changed();
+		}
+
+		return *this;
+	}
+
+	precission_t get(variable var) const
+	{
+		return m_variables[var];
+	}
+
+	void set(variable var, precission_t value)
+	{
+		m_variables[var] = value;
+	}
+
+	precission_t get(parameter param) const
+	{
+		return m_parameters[param];
+	}
+
+	void set(parameter param, precission_t value)
+	{
+		if (!m_owned) {
+			m_block = make_block(m_parameters);
+			m_owned = true;
+			m_parameters = m_block.get();
+		}
+
+		m_parameters[param] = value;
+		parameters_changed();
+	}
+
+	/* The block in use, which can be given to other systems through ConstructorArgs::shared */
+	parameters_ptr const &parameters() const
+	{
+		m_owned = false;
+
+		return m_block;
+	}
+
+	bool shares_parameters() const
+	{
+		return !m_owned;
+	}
+
+protected:
+	/* Lets the model update what it derives from the parameters, see ParameterHookConcept */
+	void parameters_changed()
+	{
+		if constexpr (ParameterHookConcept<Model>) {
+			Model::on_parameters_changed(m_parameters);
+		}
+	}
+
+private:
+	static parameters_ptr make_block(precission_t const *params)
+	{
+		parameters_ptr block(new precission_t[Model::n_parameters]);
+		std::copy(params, params + Model::n_parameters, block.get());
+
+		return block;
+	}
+};
+
+#endif /*SHAREDPARAMETERSSYSTEMWRAPPER_H_*/
@@ -74,17 +74,21 @@ public:
 	SystemWrapper(ConstructorArgs const &args) : Model()
 	{
 		std::copy(args.params, args.params + Model::n_parameters, m_parameters);
+		parameters_changed();
 	}
 
 	SystemWrapper(ConstructorArgs const &&args) : Model()
 	{
 		std::copy(args.params, args.params + Model::n_parameters, m_parameters);
+		parameters_changed();
 	}
 
-	SystemWrapper(SystemWrapper<Model> const &system)
+	/* The model is copied too, so whatever it holds (e.g. a rate table) is kept */
+	SystemWrapper(SystemWrapper<Model> const &system) : Model(system)
 	{
 	  std::copy(system.m_parameters, system.m_parameters + Model::n_parameters, m_parameters);
 	  std::copy(system.m_variables, system.m_variables + Model::n_variables, m_variables);
+	  parameters_changed();
 	}
 
 	precission_t get(variable var) const
@@ -105,6 +109,16 @@ public:
 	void set(parameter param, precission_t value)
 	{
 		m_parameters[param] = value;
+		parameters_changed();
+	}
+
+protected:
+	/* Lets the model update what it derives from the parameters, see ParameterHookConcept */
+	void parameters_changed()
+	{
+		if constexpr (ParameterHookConcept<Model>) {
+			Model::on_parameters_changed(m_parameters);
+		}
 	}
 };
 